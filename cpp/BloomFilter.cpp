@@ -0,0 +1,78 @@
+
+#include "cpp/ParquetSharpExport.h"
+#include "ExceptionInfo.h"
+
+#include <vector>
+#include <parquet/bloom_filter.h>
+
+using namespace parquet;
+
+namespace
+{
+	void find_hashes(const BloomFilter& bloom_filter, const uint64_t* hashes, int num_values, bool* found)
+	{
+		for (int i = 0; i != num_values; ++i)
+		{
+			found[i] = bloom_filter.FindHash(hashes[i]);
+		}
+	}
+}
+
+extern "C"
+{
+	PARQUETSHARP_EXPORT void BloomFilter_Free(BloomFilter* bloom_filter)
+	{
+		delete bloom_filter;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilter_Get_Bitset_Size(const BloomFilter* bloom_filter, uint32_t* bitset_size)
+	{
+		TRYCATCH(*bitset_size = bloom_filter->GetBitsetSize();)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilter_Find_Hashes(const BloomFilter* bloom_filter, const uint64_t* hashes, int num_values, bool* found)
+	{
+		TRYCATCH(find_hashes(*bloom_filter, hashes, num_values, found);)
+	}
+
+#define DEFINE_BLOOM_FILTER_HASHES(ParquetType, NativeType)												\
+																										\
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilter_Hashes_##ParquetType(								\
+		const BloomFilter* bloom_filter, const NativeType* values, int num_values, uint64_t* hashes)	\
+	{																									\
+		TRYCATCH(bloom_filter->Hashes(values, num_values, hashes);)										\
+	}																									\
+																										\
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilter_Might_Contain_##ParquetType(							\
+		const BloomFilter* bloom_filter, const NativeType* values, int num_values, bool* found)			\
+	{																									\
+		TRYCATCH(																						\
+			std::vector<uint64_t> hashes(num_values);													\
+			bloom_filter->Hashes(values, num_values, hashes.data());									\
+			find_hashes(*bloom_filter, hashes.data(), num_values, found);)								\
+	}																									\
+
+	DEFINE_BLOOM_FILTER_HASHES(Int32, int32_t)
+	DEFINE_BLOOM_FILTER_HASHES(Int64, int64_t)
+	DEFINE_BLOOM_FILTER_HASHES(Float, float)
+	DEFINE_BLOOM_FILTER_HASHES(Double, double)
+	DEFINE_BLOOM_FILTER_HASHES(Int96, Int96)
+	DEFINE_BLOOM_FILTER_HASHES(ByteArray, ByteArray)
+
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilter_Hashes_FLBA(
+		const BloomFilter* bloom_filter, const FixedLenByteArray* values, uint32_t type_length, int num_values, uint64_t* hashes)
+	{
+		TRYCATCH(bloom_filter->Hashes(values, type_length, num_values, hashes);)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilter_Might_Contain_FLBA(
+		const BloomFilter* bloom_filter, const FixedLenByteArray* values, uint32_t type_length, int num_values, bool* found)
+	{
+		TRYCATCH
+		(
+			std::vector<uint64_t> hashes(num_values);
+			bloom_filter->Hashes(values, type_length, num_values, hashes.data());
+			find_hashes(*bloom_filter, hashes.data(), num_values, found);
+		)
+	}
+}
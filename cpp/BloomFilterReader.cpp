@@ -0,0 +1,35 @@
+
+#include "cpp/ParquetSharpExport.h"
+#include "ExceptionInfo.h"
+
+#include <parquet/bloom_filter_reader.h>
+
+using namespace parquet;
+
+extern "C"
+{
+	PARQUETSHARP_EXPORT ExceptionInfo* BloomFilterReader_RowGroup(
+		BloomFilterReader* bloom_filter_reader,
+		int i,
+		std::shared_ptr<RowGroupBloomFilterReader>** row_group_bloom_filter_reader)
+	{
+		TRYCATCH
+		(
+			auto reader = bloom_filter_reader->RowGroup(i);
+			*row_group_bloom_filter_reader = reader ? new std::shared_ptr(std::move(reader)) : nullptr;
+		)
+	}
+
+	PARQUETSHARP_EXPORT void RowGroupBloomFilterReader_Free(const std::shared_ptr<RowGroupBloomFilterReader>* row_group_bloom_filter_reader)
+	{
+		delete row_group_bloom_filter_reader;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupBloomFilterReader_GetColumnBloomFilter(
+		const std::shared_ptr<RowGroupBloomFilterReader>* row_group_bloom_filter_reader,
+		int i,
+		BloomFilter** bloom_filter)
+	{
+		TRYCATCH(*bloom_filter = (*row_group_bloom_filter_reader)->GetColumnBloomFilter(i).release();)
+	}
+}
@@ -52,6 +52,26 @@ extern "C"
 		TRYCATCH(*file_offset = column_chunk_meta_data->file_offset();)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* ColumnChunkMetaData_Is_Fully_Dictionary_Encoded(const ColumnChunkMetaData* column_chunk_meta_data, bool* is_fully_dictionary_encoded)
+	{
+		TRYCATCH
+		(
+			// Mirrors the check used by the Arrow reader: the first page must be the dictionary page,
+			// and all following data pages must be dictionary encoded (ie. no fallback to plain encoding).
+			const auto& encoding_stats = column_chunk_meta_data->encoding_stats();
+			bool result = !encoding_stats.empty() &&
+				encoding_stats[0].page_type == PageType::DICTIONARY_PAGE &&
+				(encoding_stats[0].encoding == Encoding::PLAIN || encoding_stats[0].encoding == Encoding::PLAIN_DICTIONARY);
+			for (size_t i = 1; result && i < encoding_stats.size(); ++i)
+			{
+				result =
+					(encoding_stats[i].page_type == PageType::DATA_PAGE || encoding_stats[i].page_type == PageType::DATA_PAGE_V2) &&
+					(encoding_stats[i].encoding == Encoding::RLE_DICTIONARY || encoding_stats[i].encoding == Encoding::PLAIN_DICTIONARY);
+			}
+			*is_fully_dictionary_encoded = result;
+		)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* ColumnChunkMetaData_Is_Stats_Set(const ColumnChunkMetaData* column_chunk_meta_data, bool* is_stats_set)
 	{
 		TRYCATCH(*is_stats_set = column_chunk_meta_data->is_stats_set();)
@@ -0,0 +1,79 @@
+
+#include "cpp/ParquetSharpExport.h"
+#include "ExceptionInfo.h"
+
+#include <algorithm>
+#include <parquet/page_index.h>
+
+using namespace parquet;
+
+extern "C"
+{
+	PARQUETSHARP_EXPORT void ColumnIndex_Free(const std::shared_ptr<ColumnIndex>* column_index)
+	{
+		delete column_index;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ColumnIndex_Num_Pages(const std::shared_ptr<ColumnIndex>* column_index, int32_t* num_pages)
+	{
+		TRYCATCH(*num_pages = static_cast<int32_t>((*column_index)->null_pages().size());)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ColumnIndex_Null_Pages(const std::shared_ptr<ColumnIndex>* column_index, bool* null_pages)
+	{
+		TRYCATCH
+		(
+			const auto& pages = (*column_index)->null_pages();
+			std::copy(pages.begin(), pages.end(), null_pages);
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ColumnIndex_Has_Null_Counts(const std::shared_ptr<ColumnIndex>* column_index, bool* has_null_counts)
+	{
+		TRYCATCH(*has_null_counts = (*column_index)->has_null_counts();)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ColumnIndex_Null_Counts(const std::shared_ptr<ColumnIndex>* column_index, int64_t* null_counts)
+	{
+		TRYCATCH
+		(
+			const auto& counts = (*column_index)->null_counts();
+			std::copy(counts.begin(), counts.end(), null_counts);
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ColumnIndex_Boundary_Order(const std::shared_ptr<ColumnIndex>* column_index, BoundaryOrder::type* boundary_order)
+	{
+		TRYCATCH(*boundary_order = (*column_index)->boundary_order();)
+	}
+
+#define DEFINE_TYPED_COLUMN_INDEX(ParquetType, DType, NativeType)									\
+																									\
+	PARQUETSHARP_EXPORT ExceptionInfo* TypedColumnIndex_Min_Values_##ParquetType(					\
+		const std::shared_ptr<ColumnIndex>* column_index,											\
+		NativeType* min_values)																		\
+	{																								\
+		TRYCATCH(																					\
+			const auto& values = static_cast<TypedColumnIndex<DType>&>(**column_index).min_values();\
+			std::copy(values.begin(), values.end(), min_values);)									\
+	}																								\
+																									\
+	PARQUETSHARP_EXPORT ExceptionInfo* TypedColumnIndex_Max_Values_##ParquetType(					\
+		const std::shared_ptr<ColumnIndex>* column_index,											\
+		NativeType* max_values)																		\
+	{																								\
+		TRYCATCH(																					\
+			const auto& values = static_cast<TypedColumnIndex<DType>&>(**column_index).max_values();\
+			std::copy(values.begin(), values.end(), max_values);)									\
+	}																								\
+
+
+	DEFINE_TYPED_COLUMN_INDEX(Bool, BooleanType, bool)
+	DEFINE_TYPED_COLUMN_INDEX(Int32, Int32Type, int32_t)
+	DEFINE_TYPED_COLUMN_INDEX(Int64, Int64Type, int64_t)
+	DEFINE_TYPED_COLUMN_INDEX(Float, FloatType, float)
+	DEFINE_TYPED_COLUMN_INDEX(Double, DoubleType, double)
+	DEFINE_TYPED_COLUMN_INDEX(ByteArray, ByteArrayType, ByteArray)
+	DEFINE_TYPED_COLUMN_INDEX(FLBA, FLBAType, FixedLenByteArray)
+
+}
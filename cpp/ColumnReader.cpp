@@ -13,18 +13,8 @@ extern "C"
 		delete column_reader;
 	}
 
-	PARQUETSHARP_EXPORT ExceptionInfo* ColumnReader_Descr(const std::shared_ptr<ColumnReader>* column_reader, const ColumnDescriptor** column_descriptor)
-	{
-		TRYCATCH(*column_descriptor = (*column_reader)->descr();)
-	}
-
 	PARQUETSHARP_EXPORT ExceptionInfo* ColumnReader_HasNext(const std::shared_ptr<ColumnReader>* column_reader, bool* has_next)
 	{
 		TRYCATCH(*has_next =(*column_reader)->HasNext();)
 	}
-
-	PARQUETSHARP_EXPORT ExceptionInfo* ColumnReader_Type(const std::shared_ptr<ColumnReader>* column_reader, Type::type* type)
-	{
-		TRYCATCH(*type = (*column_reader)->type();)
-	}
 }
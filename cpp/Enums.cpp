@@ -14,6 +14,10 @@ namespace
 		static_assert(ColumnOrder::UNDEFINED == 0);
 		static_assert(ColumnOrder::TYPE_DEFINED_ORDER == 1);
 
+		static_assert(BoundaryOrder::Unordered == 0);
+		static_assert(BoundaryOrder::Ascending == 1);
+		static_assert(BoundaryOrder::Descending == 2);
+
 		static_assert(Compression::UNCOMPRESSED == 0);
 		static_assert(Compression::SNAPPY == 1);
 		static_assert(Compression::GZIP == 2);
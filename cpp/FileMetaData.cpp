@@ -6,6 +6,41 @@
 
 using namespace parquet;
 
+namespace
+{
+	// Whether the file is encrypted, in which case its metadata can't be reused without the file decryptor it was read with.
+	// Files with an encrypted footer don't record this in the metadata itself, but all of their columns have crypto metadata.
+	bool IsEncrypted(const FileMetaData& file_meta_data)
+	{
+		if (file_meta_data.is_encryption_algorithm_set())
+		{
+			return true;
+		}
+		if (file_meta_data.num_row_groups() == 0)
+		{
+			return false;
+		}
+
+		try
+		{
+			const auto row_group = file_meta_data.RowGroup(0);
+			for (int i = 0; i != row_group->num_columns(); ++i)
+			{
+				if (row_group->ColumnChunk(i)->crypto_metadata())
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+		catch (const ParquetException&)
+		{
+			// Column metadata that can't be read without keys is encrypted
+			return true;
+		}
+	}
+}
+
 extern "C"
 {
 	struct ApplicationVersionCStruct
@@ -27,6 +62,11 @@ extern "C"
 		delete file_meta_data;
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* FileMetaData_Share(const std::shared_ptr<FileMetaData>* file_meta_data, std::shared_ptr<FileMetaData>** shared)
+	{
+		TRYCATCH(*shared = new std::shared_ptr(*file_meta_data);)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* FileMetaData_Created_By(const std::shared_ptr<FileMetaData>* file_meta_data, const char** created_by)
 	{
 		TRYCATCH(*created_by = (*file_meta_data)->created_by().c_str();)
@@ -37,6 +77,34 @@ extern "C"
 		TRYCATCH(*equals = (*file_meta_data)->Equals(**other);)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* FileMetaData_Is_Encrypted(const std::shared_ptr<FileMetaData>* file_meta_data, bool* is_encrypted)
+	{
+		TRYCATCH(*is_encrypted = IsEncrypted(**file_meta_data);)
+	}
+
+	// Get the total compressed size of the specified column chunks of each of the specified row groups
+	PARQUETSHARP_EXPORT ExceptionInfo* FileMetaData_Total_Compressed_Sizes(
+		const std::shared_ptr<FileMetaData>* file_meta_data,
+		const int* row_groups,
+		int num_row_groups,
+		const int* columns,
+		int num_columns,
+		int64_t* sizes)
+	{
+		TRYCATCH
+		(
+			for (int i = 0; i != num_row_groups; ++i)
+			{
+				const auto row_group = (*file_meta_data)->RowGroup(row_groups[i]);
+				sizes[i] = 0;
+				for (int j = 0; j != num_columns; ++j)
+				{
+					sizes[i] += row_group->ColumnChunk(columns[j])->total_compressed_size();
+				}
+			}
+		)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* FileMetaData_Key_Value_Metadata(const std::shared_ptr<FileMetaData>* file_meta_data, std::shared_ptr<const KeyValueMetadata>** key_value_metadata)
 	{
 		TRYCATCH
@@ -0,0 +1,176 @@
+#include "cpp/ParquetSharpExport.h"
+#include "ExceptionInfo.h"
+
+#include <cstring>
+#include <parquet/column_reader.h>
+#include <parquet/exception.h>
+#include <parquet/file_reader.h>
+#include <parquet/level_conversion.h>
+#include <parquet/metadata.h>
+#include <parquet/schema.h>
+
+using namespace parquet;
+
+// Reads whole records of a list column with a single level of repetition in bulk,
+// converting repetition and definition levels to list offsets natively.
+struct ListRecordReader
+{
+	std::shared_ptr<internal::RecordReader> record_reader;
+	internal::LevelInfo list_info;
+	int value_size;
+};
+
+extern "C"
+{
+	PARQUETSHARP_EXPORT ExceptionInfo* ListRecordReader_Create(const std::shared_ptr<RowGroupReader>* row_group_reader, int i, ListRecordReader** list_record_reader)
+	{
+		TRYCATCH
+		(
+			const auto* descr = (*row_group_reader)->metadata()->schema()->Column(i);
+			if (descr->max_repetition_level() != 1)
+			{
+				throw ParquetException("list record reads are only supported for columns with a single level of repetition");
+			}
+			if (descr->physical_type() == Type::BYTE_ARRAY || descr->physical_type() == Type::FIXED_LEN_BYTE_ARRAY)
+			{
+				throw ParquetException("list record reads are only supported for fixed width physical types");
+			}
+
+			// A list has an element when the definition level reaches that of the repeated node.
+			internal::LevelInfo list_info;
+			list_info.rep_level = 1;
+			list_info.def_level = descr->max_definition_level();
+			for (const auto* node = descr->schema_node().get(); !node->is_repeated(); node = node->parent())
+			{
+				if (node->is_optional())
+				{
+					--list_info.def_level;
+				}
+			}
+
+			// Values are read densely, the element definition levels are used to place null elements.
+			auto record_reader = internal::RecordReader::Make(
+				descr, internal::LevelInfo::ComputeLevelInfo(descr), ::arrow::default_memory_pool(),
+				/*read_dictionary=*/false, /*read_dense_for_nullable=*/true);
+			record_reader->SetPageReader((*row_group_reader)->GetColumnPageReader(i));
+
+			auto* reader = new ListRecordReader();
+			reader->record_reader = std::move(record_reader);
+			reader->list_info = list_info;
+			reader->value_size = GetTypeByteSize(descr->physical_type());
+			*list_record_reader = reader;
+		)
+	}
+
+	PARQUETSHARP_EXPORT void ListRecordReader_Free(ListRecordReader* list_record_reader)
+	{
+		delete list_record_reader;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ListRecordReader_ReadRecords(
+		ListRecordReader* list_record_reader,
+		int64_t num_records,
+		int64_t* records_read,
+		int64_t* num_values,
+		int64_t* num_elements)
+	{
+		TRYCATCH
+		(
+			auto& record_reader = *list_record_reader->record_reader;
+
+			// Discard the records returned by the previous call
+			record_reader.Reset();
+
+			int64_t total_records_read = 0;
+			while (total_records_read < num_records && record_reader.HasMoreData())
+			{
+				const auto read = record_reader.ReadRecords(num_records - total_records_read);
+				if (read == 0)
+				{
+					break;
+				}
+				total_records_read += read;
+			}
+
+			const auto* def_levels = record_reader.def_levels();
+			const auto num_levels = record_reader.levels_position();
+			int64_t elements = 0;
+			for (int64_t level = 0; level < num_levels; ++level)
+			{
+				elements += def_levels[level] >= list_record_reader->list_info.def_level;
+			}
+
+			*records_read = total_records_read;
+			*num_values = record_reader.values_written();
+			*num_elements = elements;
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ListRecordReader_ReadLists(
+		ListRecordReader* list_record_reader,
+		int64_t num_records,
+		void* values,
+		int16_t* element_def_levels,
+		int32_t* offsets,
+		uint8_t* list_valid_bits,
+		int64_t* list_null_count)
+	{
+		TRYCATCH
+		(
+			auto& record_reader = *list_record_reader->record_reader;
+			const auto& list_info = list_record_reader->list_info;
+			const auto* def_levels = record_reader.def_levels();
+			const auto* rep_levels = record_reader.rep_levels();
+			const auto num_levels = record_reader.levels_position();
+
+			if (record_reader.values_written() > 0)
+			{
+				std::memcpy(values, record_reader.values(), record_reader.values_written() * list_record_reader->value_size);
+			}
+
+			if (element_def_levels != nullptr)
+			{
+				for (int64_t level = 0; level < num_levels; ++level)
+				{
+					if (def_levels[level] >= list_info.def_level)
+					{
+						*element_def_levels++ = def_levels[level];
+					}
+				}
+			}
+
+			internal::ValidityBitmapInputOutput validity;
+			validity.values_read_upper_bound = num_records;
+			validity.valid_bits = list_valid_bits;
+			offsets[0] = 0;
+			internal::DefRepLevelsToList(def_levels, rep_levels, num_levels, list_info, &validity, offsets);
+
+			if (validity.values_read != num_records)
+			{
+				throw ParquetException("number of lists read does not match the number of records");
+			}
+			*list_null_count = validity.null_count;
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ListRecordReader_SkipRecords(ListRecordReader* list_record_reader, int64_t num_records, int64_t* records_skipped)
+	{
+		TRYCATCH
+		(
+			auto& record_reader = *list_record_reader->record_reader;
+			record_reader.Reset();
+
+			int64_t total_records_skipped = 0;
+			while (total_records_skipped < num_records && record_reader.HasMoreData())
+			{
+				const auto skipped = record_reader.SkipRecords(num_records - total_records_skipped);
+				if (skipped == 0)
+				{
+					break;
+				}
+				total_records_skipped += skipped;
+			}
+			*records_skipped = total_records_skipped;
+		)
+	}
+}
@@ -6,13 +6,26 @@
 #include <arrow/buffer.h>
 #include <arrow/io/interfaces.h>
 #include <arrow/result.h>
+#include <arrow/util/future.h>
 #include <arrow/util/logging.h>
 
+#include <memory>
+
 using arrow::Result;
 using arrow::Status;
 using arrow::StatusCode;
 
+// State of an asynchronous read started by the managed ReadAsync callback,
+// owned by the managed side until it is passed back to ManagedRandomAccessFile_CompleteRead.
+struct PendingRead
+{
+	arrow::Future<std::shared_ptr<arrow::Buffer>> future;
+	std::shared_ptr<arrow::ResizableBuffer> buffer;
+};
+
 typedef StatusCode(*ReadFunc)(int64_t, int64_t*, void*, const char**);
+typedef StatusCode(*ReadAtFunc)(int64_t, int64_t, int64_t*, void*, const char**);
+typedef StatusCode(*ReadAsyncFunc)(int64_t, int64_t, void*, PendingRead*, const char**);
 typedef StatusCode(*CloseFunc)(const char**);
 typedef StatusCode(*GetSizeFunc)(int64_t*, const char**);
 typedef StatusCode(*TellFunc)(int64_t*, const char**);
@@ -30,12 +43,16 @@ public:
 
 	ManagedRandomAccessFile(
 		const ReadFunc read,
+		const ReadAtFunc readAt,
+		const ReadAsyncFunc readAsync,
 		const CloseFunc close,
 		const GetSizeFunc getSize,
 		const TellFunc tell,
 		const SeekFunc seek,
 		const ClosedFunc closed) :
 		read_(read),
+		readAt_(readAt),
+		readAsync_(readAsync),
 		close_(close),
 		getSize_(getSize),
 		tell_(tell),
@@ -76,6 +93,73 @@ public:
 		return buffer;
 	}
 
+	// Without a positional read callback, fall back to the base implementation,
+	// which serializes concurrent reads with a lock around Seek and Read.
+	Result<int64_t> ReadAt(const int64_t position, const int64_t nbytes, void* const out) override
+	{
+		if (readAt_ == nullptr)
+		{
+			return RandomAccessFile::ReadAt(position, nbytes, out);
+		}
+
+		int64_t bytes_read;
+		const char* exception = nullptr;
+		const auto statusCode = readAt_(position, nbytes, &bytes_read, out, &exception);
+		return GetResult(bytes_read, statusCode, exception);
+	}
+
+	Result<std::shared_ptr<arrow::Buffer>> ReadAt(const int64_t position, const int64_t nbytes) override
+	{
+		if (readAt_ == nullptr)
+		{
+			return RandomAccessFile::ReadAt(position, nbytes);
+		}
+
+		ARROW_ASSIGN_OR_RAISE(auto pBuffer, arrow::AllocateResizableBuffer(nbytes));
+		std::shared_ptr<arrow::ResizableBuffer> buffer(pBuffer.release());
+
+		ARROW_ASSIGN_OR_RAISE(const int64_t bytes_read, ReadAt(position, nbytes, buffer->mutable_data()));
+		if (bytes_read < nbytes)
+		{
+			RETURN_NOT_OK(buffer->Resize(bytes_read));
+			buffer->ZeroPadding();
+		}
+
+		return buffer;
+	}
+
+	// Without an asynchronous read callback, fall back to the base implementation,
+	// which calls ReadAt on a thread of the IO context's executor.
+	arrow::Future<std::shared_ptr<arrow::Buffer>> ReadAsync(const arrow::io::IOContext& io_context, const int64_t position, const int64_t nbytes) override
+	{
+		if (readAsync_ == nullptr)
+		{
+			return RandomAccessFile::ReadAsync(io_context, position, nbytes);
+		}
+
+		auto pBuffer = arrow::AllocateResizableBuffer(nbytes, io_context.pool());
+		if (!pBuffer.ok())
+		{
+			return arrow::Future<std::shared_ptr<arrow::Buffer>>::MakeFinished(pBuffer.status());
+		}
+
+		auto pending = std::make_unique<PendingRead>();
+		pending->future = arrow::Future<std::shared_ptr<arrow::Buffer>>::Make();
+		pending->buffer = std::shared_ptr<arrow::ResizableBuffer>(pBuffer->release());
+		auto future = pending->future;
+
+		// On success the managed side takes ownership of the pending read and completes it later.
+		const char* exception = nullptr;
+		const auto statusCode = readAsync_(position, nbytes, pending->buffer->mutable_data(), pending.get(), &exception);
+		if (statusCode != StatusCode::OK)
+		{
+			return arrow::Future<std::shared_ptr<arrow::Buffer>>::MakeFinished(GetStatus(statusCode, exception));
+		}
+
+		pending.release();
+		return future;
+	}
+
 	Status Close() override
 	{
 		const char* exception = nullptr;
@@ -132,6 +216,8 @@ private:
 	}
 
 	const ReadFunc read_;
+	const ReadAtFunc readAt_;
+	const ReadAsyncFunc readAsync_;
 	const CloseFunc close_;
 	const GetSizeFunc getSize_;
 	const TellFunc tell_;
@@ -143,6 +229,8 @@ extern "C"
 {
 	PARQUETSHARP_EXPORT ExceptionInfo* ManagedRandomAccessFile_Create(
 		const ReadFunc read,
+		const ReadAtFunc readAt,
+		const ReadAsyncFunc readAsync,
 		const CloseFunc close,
 		const GetSizeFunc getSize,
 		const TellFunc tell,
@@ -150,6 +238,34 @@ extern "C"
 		const ClosedFunc closed,
 		std::shared_ptr<ManagedRandomAccessFile>** stream)
 	{
-		TRYCATCH(*stream = new std::shared_ptr<ManagedRandomAccessFile>(new ManagedRandomAccessFile(read, close, getSize, tell, seek, closed));)
+		TRYCATCH(*stream = new std::shared_ptr<ManagedRandomAccessFile>(new ManagedRandomAccessFile(read, readAt, readAsync, close, getSize, tell, seek, closed));)
+	}
+
+	PARQUETSHARP_EXPORT void ManagedRandomAccessFile_CompleteRead(
+		PendingRead* const pending_read,
+		const int64_t bytes_read,
+		const StatusCode statusCode,
+		const char* const exception)
+	{
+		const std::unique_ptr<PendingRead> pending(pending_read);
+
+		if (statusCode != StatusCode::OK)
+		{
+			pending->future.MarkFinished(Status(statusCode, exception == nullptr ? "" : exception));
+			return;
+		}
+
+		if (bytes_read < pending->buffer->size())
+		{
+			const auto status = pending->buffer->Resize(bytes_read);
+			if (!status.ok())
+			{
+				pending->future.MarkFinished(status);
+				return;
+			}
+			pending->buffer->ZeroPadding();
+		}
+
+		pending->future.MarkFinished(std::shared_ptr<arrow::Buffer>(std::move(pending->buffer)));
 	}
 }
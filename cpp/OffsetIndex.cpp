@@ -0,0 +1,32 @@
+
+#include "cpp/ParquetSharpExport.h"
+#include "ExceptionInfo.h"
+
+#include <cstddef>
+#include <parquet/page_index.h>
+
+using namespace parquet;
+
+// The C# PageLocation struct is blitted directly from the native page locations, so its layout must match.
+static_assert(sizeof(PageLocation) == 24);
+static_assert(offsetof(PageLocation, offset) == 0);
+static_assert(offsetof(PageLocation, compressed_page_size) == 8);
+static_assert(offsetof(PageLocation, first_row_index) == 16);
+
+extern "C"
+{
+	PARQUETSHARP_EXPORT void OffsetIndex_Free(const std::shared_ptr<OffsetIndex>* offset_index)
+	{
+		delete offset_index;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* OffsetIndex_Page_Locations(const std::shared_ptr<OffsetIndex>* offset_index, const PageLocation** page_locations)
+	{
+		TRYCATCH(*page_locations = (*offset_index)->page_locations().data();)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* OffsetIndex_Page_Locations_Count(const std::shared_ptr<OffsetIndex>* offset_index, size_t* count)
+	{
+		TRYCATCH(*count = (*offset_index)->page_locations().size();)
+	}
+}
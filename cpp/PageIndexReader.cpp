@@ -0,0 +1,56 @@
+
+#include "cpp/ParquetSharpExport.h"
+#include "ExceptionInfo.h"
+
+#include <parquet/page_index.h>
+
+using namespace parquet;
+
+extern "C"
+{
+	PARQUETSHARP_EXPORT void PageIndexReader_Free(const std::shared_ptr<PageIndexReader>* page_index_reader)
+	{
+		delete page_index_reader;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* PageIndexReader_RowGroup(
+		const std::shared_ptr<PageIndexReader>* page_index_reader,
+		int i,
+		std::shared_ptr<RowGroupPageIndexReader>** row_group_page_index_reader)
+	{
+		TRYCATCH
+		(
+			auto reader = (*page_index_reader)->RowGroup(i);
+			*row_group_page_index_reader = reader ? new std::shared_ptr(std::move(reader)) : nullptr;
+		)
+	}
+
+	PARQUETSHARP_EXPORT void RowGroupPageIndexReader_Free(const std::shared_ptr<RowGroupPageIndexReader>* row_group_page_index_reader)
+	{
+		delete row_group_page_index_reader;
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupPageIndexReader_GetColumnIndex(
+		const std::shared_ptr<RowGroupPageIndexReader>* row_group_page_index_reader,
+		int i,
+		std::shared_ptr<ColumnIndex>** column_index)
+	{
+		TRYCATCH
+		(
+			auto index = (*row_group_page_index_reader)->GetColumnIndex(i);
+			*column_index = index ? new std::shared_ptr(std::move(index)) : nullptr;
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupPageIndexReader_GetOffsetIndex(
+		const std::shared_ptr<RowGroupPageIndexReader>* row_group_page_index_reader,
+		int i,
+		std::shared_ptr<OffsetIndex>** offset_index)
+	{
+		TRYCATCH
+		(
+			auto index = (*row_group_page_index_reader)->GetOffsetIndex(i);
+			*offset_index = index ? new std::shared_ptr(std::move(index)) : nullptr;
+		)
+	}
+}
@@ -2,7 +2,14 @@
 #include "cpp/ParquetSharpExport.h"
 #include "ExceptionInfo.h"
 
+#include <arrow/io/caching.h>
+#include <arrow/io/file.h>
+#include <arrow/io/interfaces.h>
+#include <parquet/bloom_filter_reader.h>
 #include <parquet/file_reader.h>
+#include <parquet/page_index.h>
+
+#include <vector>
 
 using namespace parquet;
 
@@ -10,18 +17,38 @@ extern "C"
 {
 	PARQUETSHARP_EXPORT ExceptionInfo* ParquetFileReader_OpenFile(
 		const char* const path,
+		const bool memory_map,
 		const ReaderProperties* reader_properties,
+		const std::shared_ptr<FileMetaData>* metadata,
+		std::shared_ptr<::arrow::io::RandomAccessFile>** source,
 		ParquetFileReader** reader)
 	{
-		TRYCATCH(*reader = ParquetFileReader::OpenFile(path, false, *reader_properties).release();)
+		// Open the file as ParquetFileReader::OpenFile does, but also return it so that selected pages can be read directly.
+		// The footer is only read and parsed if no metadata is provided
+		TRYCATCH
+		(
+			std::shared_ptr<::arrow::io::RandomAccessFile> file;
+			if (memory_map)
+			{
+				PARQUET_ASSIGN_OR_THROW(file, ::arrow::io::MemoryMappedFile::Open(path, ::arrow::io::FileMode::READ));
+			}
+			else
+			{
+				PARQUET_ASSIGN_OR_THROW(file, ::arrow::io::ReadableFile::Open(path, reader_properties->memory_pool()));
+			}
+
+			*reader = ParquetFileReader::Open(file, *reader_properties, metadata == nullptr ? nullptr : *metadata).release();
+			*source = new std::shared_ptr(std::move(file));
+		)
 	}
 
 	PARQUETSHARP_EXPORT ExceptionInfo* ParquetFileReader_Open(
 		std::shared_ptr<::arrow::io::RandomAccessFile>* readable_file_interface, 
 		const ReaderProperties* reader_properties,
+		const std::shared_ptr<FileMetaData>* metadata,
 		ParquetFileReader** reader)
 	{
-		TRYCATCH(*reader = ParquetFileReader::Open(*readable_file_interface, *reader_properties).release();)
+		TRYCATCH(*reader = ParquetFileReader::Open(*readable_file_interface, *reader_properties, metadata == nullptr ? nullptr : *metadata).release();)
 	}
 
 	PARQUETSHARP_EXPORT void ParquetFileReader_Free(ParquetFileReader* reader)
@@ -43,4 +70,61 @@ extern "C"
 	{
 		TRYCATCH(*rowGroupReader = new std::shared_ptr(reader->RowGroup(i));)
 	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ParquetFileReader_GetPageIndexReader(ParquetFileReader* reader, std::shared_ptr<PageIndexReader>** page_index_reader)
+	{
+		TRYCATCH
+		(
+			auto page_index = reader->GetPageIndexReader();
+			*page_index_reader = page_index ? new std::shared_ptr(std::move(page_index)) : nullptr;
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ParquetFileReader_GetBloomFilterReader(ParquetFileReader* reader, BloomFilterReader** bloom_filter_reader)
+	{
+		TRYCATCH(*bloom_filter_reader = &reader->GetBloomFilterReader();)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ParquetFileReader_PreBuffer(
+		ParquetFileReader* reader,
+		const int32_t* row_groups,
+		const int32_t num_row_groups,
+		const int32_t* column_indices,
+		const int32_t num_columns,
+		const int64_t hole_size_limit,
+		const int64_t range_size_limit,
+		const bool lazy,
+		const int64_t prefetch_limit)
+	{
+		TRYCATCH
+		(
+			::arrow::io::CacheOptions cache_options;
+			cache_options.hole_size_limit = hole_size_limit;
+			cache_options.range_size_limit = range_size_limit;
+			cache_options.lazy = lazy;
+			cache_options.prefetch_limit = prefetch_limit;
+
+			reader->PreBuffer(
+				std::vector<int>(row_groups, row_groups + num_row_groups),
+				std::vector<int>(column_indices, column_indices + num_columns),
+				::arrow::io::default_io_context(),
+				cache_options);
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* ParquetFileReader_WhenBuffered(
+		const ParquetFileReader* reader,
+		const int32_t* row_groups,
+		const int32_t num_row_groups,
+		const int32_t* column_indices,
+		const int32_t num_columns)
+	{
+		TRYCATCH
+		(
+			const auto future = reader->WhenBuffered(
+				std::vector<int>(row_groups, row_groups + num_row_groups),
+				std::vector<int>(column_indices, column_indices + num_columns));
+			PARQUET_THROW_NOT_OK(future.status());
+		)
+	}
 }
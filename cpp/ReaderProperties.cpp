@@ -18,6 +18,11 @@ extern "C"
 		TRYCATCH(*reader_properties = new ReaderProperties(memory_pool);)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* ReaderProperties_Copy(const ReaderProperties* reader_properties, ReaderProperties** copy)
+	{
+		TRYCATCH(*copy = new ReaderProperties(*reader_properties);)
+	}
+
 	PARQUETSHARP_EXPORT void ReaderProperties_Free(ReaderProperties* reader_properties)
 	{
 		delete reader_properties;
@@ -2,10 +2,192 @@
 #include "cpp/ParquetSharpExport.h"
 #include "ExceptionInfo.h"
 
+#include <arrow/buffer.h>
+#include <arrow/io/interfaces.h>
+#include <arrow/io/memory.h>
+#include <parquet/column_page.h>
+#include <parquet/column_reader.h>
+#include <parquet/exception.h>
 #include <parquet/file_reader.h>
+#include <parquet/metadata.h>
+#include <parquet/page_index.h>
+#include <parquet/properties.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace parquet;
 
+namespace
+{
+	// Read up to batch_size levels from a column, continuing across data pages until the batch is full or the column chunk ends.
+	template <typename DType>
+	int64_t ReadBatchFully(
+		ColumnReader& column_reader,
+		const int64_t batch_size,
+		int16_t* def_levels,
+		int16_t* rep_levels,
+		void* values,
+		int64_t* values_read)
+	{
+		auto& reader = static_cast<TypedColumnReader<DType>&>(column_reader);
+		auto* typed_values = static_cast<typename DType::c_type*>(values);
+		int64_t total_levels_read = 0;
+		*values_read = 0;
+
+		while (total_levels_read < batch_size && reader.HasNext())
+		{
+			int64_t batch_values_read = 0;
+			total_levels_read += reader.ReadBatch(
+				batch_size - total_levels_read,
+				def_levels == nullptr ? nullptr : def_levels + total_levels_read,
+				rep_levels == nullptr ? nullptr : rep_levels + total_levels_read,
+				typed_values + *values_read,
+				&batch_values_read);
+			*values_read += batch_values_read;
+		}
+
+		return total_levels_read;
+	}
+
+	int64_t ReadBatchFully(
+		ColumnReader& column_reader,
+		const int64_t batch_size,
+		int16_t* def_levels,
+		int16_t* rep_levels,
+		void* values,
+		int64_t* values_read)
+	{
+		const auto* descr = column_reader.descr();
+		if (descr->max_definition_level() > 0 && def_levels == nullptr)
+		{
+			throw ParquetException("definition levels are required for column '" + descr->path()->ToDotString() + "'");
+		}
+		if (descr->max_repetition_level() > 0 && rep_levels == nullptr)
+		{
+			throw ParquetException("repetition levels are required for column '" + descr->path()->ToDotString() + "'");
+		}
+
+		switch (column_reader.type())
+		{
+			case Type::BOOLEAN:
+				return ReadBatchFully<BooleanType>(column_reader, batch_size, def_levels, rep_levels, values, values_read);
+			case Type::INT32:
+				return ReadBatchFully<Int32Type>(column_reader, batch_size, def_levels, rep_levels, values, values_read);
+			case Type::INT64:
+				return ReadBatchFully<Int64Type>(column_reader, batch_size, def_levels, rep_levels, values, values_read);
+			case Type::INT96:
+				return ReadBatchFully<Int96Type>(column_reader, batch_size, def_levels, rep_levels, values, values_read);
+			case Type::FLOAT:
+				return ReadBatchFully<FloatType>(column_reader, batch_size, def_levels, rep_levels, values, values_read);
+			case Type::DOUBLE:
+				return ReadBatchFully<DoubleType>(column_reader, batch_size, def_levels, rep_levels, values, values_read);
+			default:
+				// Byte array values point into page buffers, which don't outlive a read spanning multiple pages
+				throw ParquetException("multi-column batch reads are only supported for fixed width physical types");
+		}
+	}
+
+	// Read only the dictionary page and the selected data pages of a column chunk from the file,
+	// and return a page reader over these pages as if they were the whole column chunk.
+	std::unique_ptr<PageReader> ReadSelectedPages(
+		::arrow::io::RandomAccessFile& source,
+		const ReaderProperties& properties,
+		const FileMetaData& file_meta_data,
+		const ColumnChunkMetaData& column_chunk,
+		const PageLocation* page_locations,
+		const bool* selected_pages,
+		const int num_pages)
+	{
+		std::vector<::arrow::io::ReadRange> ranges;
+		const auto add_range = [&ranges](const int64_t offset, const int64_t length)
+		{
+			if (length <= 0)
+			{
+				return;
+			}
+			if (!ranges.empty() && ranges.back().offset + ranges.back().length == offset)
+			{
+				ranges.back().length += length;
+			}
+			else
+			{
+				ranges.push_back({offset, length});
+			}
+		};
+
+		// Any dictionary page precedes the first data page
+		auto column_start = column_chunk.data_page_offset();
+		if (column_chunk.has_dictionary_page() && column_chunk.dictionary_page_offset() > 0 && column_chunk.dictionary_page_offset() < column_start)
+		{
+			column_start = column_chunk.dictionary_page_offset();
+		}
+		add_range(column_start, page_locations[0].offset - column_start);
+		for (int page = 0; page != num_pages; ++page)
+		{
+			if (selected_pages[page])
+			{
+				add_range(page_locations[page].offset, page_locations[page].compressed_page_size);
+			}
+		}
+
+		int64_t total_length = 0;
+		for (const auto& range : ranges)
+		{
+			total_length += range.length;
+		}
+
+		PARQUET_ASSIGN_OR_THROW(std::shared_ptr<::arrow::Buffer> buffer, ::arrow::AllocateBuffer(total_length, properties.memory_pool()));
+		int64_t position = 0;
+		for (const auto& range : ranges)
+		{
+			PARQUET_ASSIGN_OR_THROW(const auto bytes_read, source.ReadAt(range.offset, range.length, buffer->mutable_data() + position));
+			if (bytes_read != range.length)
+			{
+				throw ParquetException("unexpected end of file when reading selected pages");
+			}
+			position += bytes_read;
+		}
+
+		// Files from older writers may have uncompressed v2 data pages marked as compressed, see RowGroupReader::GetColumnPageReader
+		const bool always_compressed = file_meta_data.writer_version().VersionLt(ApplicationVersion::PARQUET_CPP_10353_FIXED_VERSION());
+		return PageReader::Open(
+			std::make_shared<::arrow::io::BufferReader>(std::move(buffer)),
+			column_chunk.num_values(),
+			column_chunk.compression(),
+			properties,
+			always_compressed);
+	}
+
+	// Joins threads when it goes out of scope, so that threads are never destroyed while joinable
+	class ThreadJoiner final
+	{
+	public:
+		explicit ThreadJoiner(std::vector<std::thread>& threads) : threads_(threads)
+		{
+		}
+
+		~ThreadJoiner()
+		{
+			for (auto& thread : threads_)
+			{
+				thread.join();
+			}
+		}
+
+		ThreadJoiner(const ThreadJoiner&) = delete;
+		ThreadJoiner& operator=(const ThreadJoiner&) = delete;
+
+	private:
+		std::vector<std::thread>& threads_;
+	};
+}
+
 extern "C"
 {
 	PARQUETSHARP_EXPORT void RowGroupReader_Free(const std::shared_ptr<RowGroupReader>* row_group_reader)
@@ -22,4 +204,135 @@ extern "C"
 	{
 		TRYCATCH(*row_group_meta_data =(*row_group_reader)->metadata();)
 	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupReader_Column_Selected_Pages(
+		const std::shared_ptr<RowGroupReader>* row_group_reader,
+		const std::shared_ptr<FileMetaData>* file_meta_data,
+		const std::shared_ptr<::arrow::io::RandomAccessFile>* source,
+		const ReaderProperties* reader_properties,
+		int i,
+		const PageLocation* page_locations,
+		const bool* selected_pages,
+		int num_pages,
+		std::shared_ptr<ColumnReader>** column_reader)
+	{
+		TRYCATCH
+		(
+			const auto* descr = (*row_group_reader)->metadata()->schema()->Column(i);
+			const auto column_chunk = (*row_group_reader)->metadata()->ColumnChunk(i);
+			std::unique_ptr<PageReader> page_reader;
+
+			// Encrypted pages can't be read out of order, as their page ordinal is part of the encryption AAD
+			if (source != nullptr && num_pages > 0 && column_chunk->crypto_metadata() == nullptr)
+			{
+				const auto& properties = reader_properties == nullptr ? default_reader_properties() : *reader_properties;
+				page_reader = ReadSelectedPages(**source, properties, **file_meta_data, *column_chunk, page_locations, selected_pages, num_pages);
+			}
+			else
+			{
+				page_reader = (*row_group_reader)->GetColumnPageReader(i);
+
+				// The filter is only called for data pages, in page order, so the data page ordinal
+				// matches the page index in the offset index. Skipped pages are never decompressed or decoded,
+				// and with a buffered stream they are stepped over without being read.
+				page_reader->set_data_page_filter(
+					[selected = std::vector<bool>(selected_pages, selected_pages + num_pages), page = 0](const DataPageStats&) mutable
+					{
+						const bool skip = page >= static_cast<int>(selected.size()) || !selected[page];
+						++page;
+						return skip;
+					});
+			}
+
+			*column_reader = new std::shared_ptr(ColumnReader::Make(descr, std::move(page_reader)));
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupReader_ReadBatches(
+		const std::shared_ptr<ColumnReader>* const* column_readers,
+		int num_columns,
+		int64_t batch_size,
+		int16_t* const* def_levels,
+		int16_t* const* rep_levels,
+		void* const* values,
+		int64_t* values_read,
+		int64_t* levels_read)
+	{
+		TRYCATCH
+		(
+			for (int i = 0; i != num_columns; ++i)
+			{
+				levels_read[i] = ReadBatchFully(**column_readers[i], batch_size, def_levels[i], rep_levels[i], values[i], &values_read[i]);
+			}
+		)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupReader_ReadColumns(
+		const std::shared_ptr<RowGroupReader>* row_group_reader,
+		const int* column_indices,
+		int num_columns,
+		const int64_t* buffer_lengths,
+		int16_t* const* def_levels,
+		int16_t* const* rep_levels,
+		void* const* values,
+		int64_t* values_read,
+		int64_t* levels_read,
+		int num_threads)
+	{
+		TRYCATCH
+		(
+			// Each column reader is created on the thread that decodes it, so that reading the column chunk
+			// from the file is also done in parallel. This requires the file to support concurrent random access reads.
+			std::atomic<int> next_column(0);
+			std::exception_ptr error;
+			std::mutex error_mutex;
+
+			const auto read_columns = [&]
+			{
+				for (int i = next_column++; i < num_columns; i = next_column++)
+				{
+					try
+					{
+						const auto column_reader = (*row_group_reader)->Column(column_indices[i]);
+						levels_read[i] = ReadBatchFully(*column_reader, buffer_lengths[i], def_levels[i], rep_levels[i], values[i], &values_read[i]);
+						if (column_reader->HasNext())
+						{
+							throw ParquetException("buffers for column " + std::to_string(column_indices[i]) + " are too small for the column chunk");
+						}
+					}
+					catch (...)
+					{
+						const std::lock_guard lock(error_mutex);
+						if (!error)
+						{
+							error = std::current_exception();
+						}
+						// Stop other threads from starting new columns
+						next_column = num_columns;
+					}
+				}
+			};
+
+			if (num_threads <= 0)
+			{
+				num_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+			}
+
+			// The calling thread also reads columns, and the threads are joined before returning, including when starting a thread fails
+			std::vector<std::thread> threads;
+			{
+				const ThreadJoiner joiner(threads);
+				for (int thread = 1; thread < std::min(num_threads, num_columns); ++thread)
+				{
+					threads.emplace_back(read_columns);
+				}
+				read_columns();
+			}
+
+			if (error)
+			{
+				std::rethrow_exception(error);
+			}
+		)
+	}
 }
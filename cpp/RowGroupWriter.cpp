@@ -48,6 +48,25 @@ extern "C"
 		TRYCATCH(*total_compressed_bytes = row_group_writer->total_compressed_bytes();)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupWriter_Estimated_Compressed_Bytes(RowGroupWriter* row_group_writer, int64_t* estimated_compressed_bytes)
+	{
+		TRYCATCH
+		(
+			int64_t estimate = row_group_writer->total_compressed_bytes() + row_group_writer->total_compressed_bytes_written();
+
+			// Values of buffered row groups that are not yet in a page are counted at their encoded size
+			if (row_group_writer->buffered())
+			{
+				for (int i = 0; i != row_group_writer->num_columns(); ++i)
+				{
+					estimate += row_group_writer->column(i)->estimated_buffered_value_bytes();
+				}
+			}
+
+			*estimated_compressed_bytes = estimate;
+		)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* RowGroupWriter_Buffered(const RowGroupWriter* row_group_writer, bool* buffered)
 	{
 		TRYCATCH(*buffered = row_group_writer->buffered();)
@@ -23,6 +23,11 @@ extern "C"
 		TRYCATCH(*has_min_max = (*statistics)->HasMinMax();)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* Statistics_HasNullCount(const std::shared_ptr<Statistics>* statistics, bool* has_null_count)
+	{
+		TRYCATCH(*has_null_count = (*statistics)->HasNullCount();)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* Statistics_Null_Count(const std::shared_ptr<Statistics>* statistics, int64_t* null_count)
 	{
 		TRYCATCH(*null_count = (*statistics)->null_count();)
@@ -2,10 +2,72 @@
 #include "cpp/ParquetSharpExport.h"
 #include "ExceptionInfo.h"
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <arrow/util/bitmap_generate.h>
 #include <parquet/column_reader.h>
+#include <parquet/exception.h>
 
 using namespace parquet;
 
+namespace
+{
+	// Read values of a flat column with space left for nulls, so that values[i] corresponds to level i,
+	// along with a validity bitmap. Null slots are default initialised.
+	// Reads continue across data pages, so this is only used for fixed width types,
+	// as byte array values point into page buffers that are released when the next page is read.
+	template <typename DType>
+	int64_t ReadBatchSpaced(
+		TypedColumnReader<DType>& reader,
+		const int64_t batch_size,
+		typename DType::c_type* values,
+		uint8_t* valid_bits,
+		int64_t* null_count)
+	{
+		const auto* descr = reader.descr();
+		if (descr->max_repetition_level() != 0)
+		{
+			throw ParquetException("spaced reads are only supported for columns without repetition levels");
+		}
+
+		// Definition levels are decoded in chunks into a fixed size buffer to avoid allocating per batch
+		const int16_t max_definition_level = descr->max_definition_level();
+		std::array<int16_t, 1024> def_levels;
+		int64_t total_levels_read = 0;
+		*null_count = 0;
+
+		while (total_levels_read < batch_size && reader.HasNext())
+		{
+			auto* batch_values = values + total_levels_read;
+			const int64_t chunk_size = std::min<int64_t>(batch_size - total_levels_read, def_levels.size());
+			int64_t values_read = 0;
+			const int64_t levels_read = reader.ReadBatch(
+				chunk_size, max_definition_level == 0 ? nullptr : def_levels.data(), nullptr, batch_values, &values_read);
+
+			if (values_read != levels_read)
+			{
+				// Values are read densely, so move them to their level position, working backwards to not overwrite unmoved values.
+				for (int64_t level = levels_read - 1, value = values_read - 1; level > value; --level)
+				{
+					batch_values[level] = def_levels[level] == max_definition_level ? batch_values[value--] : typename DType::c_type{};
+				}
+			}
+
+			int64_t level = 0;
+			::arrow::internal::GenerateBitsUnrolled(valid_bits, total_levels_read, levels_read, [&]
+			{
+				return max_definition_level == 0 || def_levels[level++] == max_definition_level;
+			});
+
+			*null_count += levels_read - values_read;
+			total_levels_read += levels_read;
+		}
+
+		return total_levels_read;
+	}
+}
+
 extern "C"
 {
 
@@ -29,6 +91,28 @@ extern "C"
 				values_read);)																	\
 	}																							\
 																								\
+	PARQUETSHARP_EXPORT ExceptionInfo* TypedColumnReader_ReadBatchWithDictionary_##ParquetType(	\
+		std::shared_ptr<ColumnReader>* columnReader, 											\
+		int64_t batch_size, 																	\
+		int16_t* def_levels, 																	\
+		int16_t* rep_levels,																	\
+		int32_t* indices, 																		\
+		int64_t* indices_read,																	\
+		const NativeType** dictionary,															\
+		int32_t* dictionary_length,																\
+		int64_t* levels_read)																	\
+	{																							\
+        TRYCATCH(																				\
+			*levels_read = static_cast<ParquetType##Reader&>(**columnReader).ReadBatchWithDictionary(	\
+				batch_size, 																	\
+				def_levels, 																	\
+				rep_levels,																		\
+				indices, 																		\
+				indices_read,																	\
+				dictionary,																		\
+				dictionary_length);)															\
+	}																							\
+																								\
 	PARQUETSHARP_EXPORT ExceptionInfo* TypedColumnReader_Skip_##ParquetType(					\
 		std::shared_ptr<ColumnReader>* columnReader,											\
 		int64_t num_rows_to_skip,																\
@@ -49,4 +133,30 @@ extern "C"
 	DEFINE_TYPED_COLUMN_READER_METHODS(ByteArray, ByteArray)
 	DEFINE_TYPED_COLUMN_READER_METHODS(FixedLenByteArray, FixedLenByteArray)
 
+#define DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(ParquetType, NativeType)						\
+																								\
+	PARQUETSHARP_EXPORT ExceptionInfo* TypedColumnReader_ReadBatchSpaced_##ParquetType(			\
+		std::shared_ptr<ColumnReader>* columnReader, 											\
+		int64_t batch_size, 																	\
+		NativeType* values, 																	\
+		uint8_t* valid_bits,																	\
+		int64_t* null_count,																	\
+		int64_t* levels_read)																	\
+	{																							\
+        TRYCATCH(																				\
+			*levels_read = ReadBatchSpaced(														\
+				static_cast<ParquetType##Reader&>(**columnReader),								\
+				batch_size, 																	\
+				values, 																		\
+				valid_bits,																		\
+				null_count);)																	\
+	}
+
+	DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(Bool, bool)
+	DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(Int32, int32_t)
+	DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(Int64, int64_t)
+	DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(Int96, Int96)
+	DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(Float, float)
+	DEFINE_TYPED_COLUMN_READER_SPACED_METHOD(Double, double)
+
 }
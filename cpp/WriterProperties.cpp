@@ -75,6 +75,20 @@ extern "C"
 		TRYCATCH(*enabled = (*writer_properties)->page_index_enabled(*path);)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* WriterProperties_Bloom_Filter_Options(const std::shared_ptr<WriterProperties>* writer_properties, const std::shared_ptr<schema::ColumnPath>* path, bool* enabled, int32_t* ndv, double* fpp)
+	{
+		TRYCATCH
+		(
+			const auto options = (*writer_properties)->bloom_filter_options(*path);
+			*enabled = options.has_value();
+			if (options)
+			{
+				*ndv = options->ndv;
+				*fpp = options->fpp;
+			}
+		)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* WriterProperties_Page_Checksum_Enabled(const std::shared_ptr<WriterProperties>* writer_properties, bool* enabled)
 	{
 		TRYCATCH(*enabled = (*writer_properties)->page_checksum_enabled();)
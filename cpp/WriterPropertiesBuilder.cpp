@@ -200,6 +200,26 @@ extern "C"
 		TRYCATCH(builder->disable_write_page_index(*path);)
 	}
 
+	PARQUETSHARP_EXPORT ExceptionInfo* WriterPropertiesBuilder_Enable_Bloom_Filter_By_Path(WriterProperties::Builder* builder, const char* path, int32_t ndv, double fpp)
+	{
+		TRYCATCH(builder->enable_bloom_filter(path, BloomFilterOptions{ndv, fpp});)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* WriterPropertiesBuilder_Enable_Bloom_Filter_By_ColumnPath(WriterProperties::Builder* builder, const std::shared_ptr<schema::ColumnPath>* path, int32_t ndv, double fpp)
+	{
+		TRYCATCH(builder->enable_bloom_filter(*path, BloomFilterOptions{ndv, fpp});)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* WriterPropertiesBuilder_Disable_Bloom_Filter_By_Path(WriterProperties::Builder* builder, const char* path)
+	{
+		TRYCATCH(builder->disable_bloom_filter(path);)
+	}
+
+	PARQUETSHARP_EXPORT ExceptionInfo* WriterPropertiesBuilder_Disable_Bloom_Filter_By_ColumnPath(WriterProperties::Builder* builder, const std::shared_ptr<schema::ColumnPath>* path)
+	{
+		TRYCATCH(builder->disable_bloom_filter(*path);)
+	}
+
 	PARQUETSHARP_EXPORT ExceptionInfo* WriterPropertiesBuilder_Enable_Page_Checksum(WriterProperties::Builder* builder)
 	{
 		TRYCATCH(builder->enable_page_checksum();)
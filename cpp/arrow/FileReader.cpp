@@ -15,18 +15,24 @@ extern "C"
 {
   PARQUETSHARP_EXPORT ExceptionInfo* FileReader_OpenPath(
     const char* const path,
+    const bool memory_map,
     const parquet::ReaderProperties* reader_properties,
     const parquet::ArrowReaderProperties* arrow_reader_properties,
-    FileReader** reader)
+    std::shared_ptr<FileReader>** reader)
   {
     TRYCATCH
     (
       arrow::MemoryPool* pool = reader_properties == nullptr
           ? arrow::default_memory_pool()
           : reader_properties->memory_pool();
-      std::shared_ptr<arrow::io::ReadableFile> input_file;
+      std::shared_ptr<arrow::io::RandomAccessFile> input_file;
       std::unique_ptr<FileReader> reader_ptr;
-      PARQUET_ASSIGN_OR_THROW(input_file, arrow::io::ReadableFile::Open(path, pool));
+      if (memory_map) {
+        // Reads return slices of the mapping, so data is served from the page cache without copying
+        PARQUET_ASSIGN_OR_THROW(input_file, arrow::io::MemoryMappedFile::Open(path, arrow::io::FileMode::READ));
+      } else {
+        PARQUET_ASSIGN_OR_THROW(input_file, arrow::io::ReadableFile::Open(path, pool));
+      }
       FileReaderBuilder builder;
       builder.memory_pool(pool);
       PARQUET_THROW_NOT_OK(builder.Open(input_file, *reader_properties));
@@ -34,7 +40,7 @@ extern "C"
         builder.properties(*arrow_reader_properties);
       }
       PARQUET_THROW_NOT_OK(builder.Build(&reader_ptr));
-      *reader = reader_ptr.release();
+      *reader = new std::shared_ptr<FileReader>(std::move(reader_ptr));
     )
   }
 
@@ -42,7 +48,7 @@ extern "C"
       std::shared_ptr<::arrow::io::RandomAccessFile>* readable_file_interface,
       const parquet::ReaderProperties* reader_properties,
       const parquet::ArrowReaderProperties* arrow_reader_properties,
-      FileReader** reader)
+      std::shared_ptr<FileReader>** reader)
   {
     TRYCATCH
     (
@@ -57,27 +63,27 @@ extern "C"
         builder.properties(*arrow_reader_properties);
       }
       PARQUET_THROW_NOT_OK(builder.Build(&reader_ptr));
-      *reader = reader_ptr.release();
+      *reader = new std::shared_ptr<FileReader>(std::move(reader_ptr));
     )
   }
 
-  PARQUETSHARP_EXPORT ExceptionInfo* FileReader_GetSchema(FileReader* reader, struct ArrowSchema* schema_out)
+  PARQUETSHARP_EXPORT ExceptionInfo* FileReader_GetSchema(const std::shared_ptr<FileReader>* reader, struct ArrowSchema* schema_out)
   {
     TRYCATCH
     (
       std::shared_ptr<arrow::Schema> schema;
-      PARQUET_THROW_NOT_OK(reader->GetSchema(&schema));
+      PARQUET_THROW_NOT_OK((*reader)->GetSchema(&schema));
       PARQUET_THROW_NOT_OK(arrow::ExportSchema(*schema, schema_out));
     )
   }
 
-  PARQUETSHARP_EXPORT ExceptionInfo* FileReader_NumRowGroups(FileReader* reader, int* num_row_groups)
+  PARQUETSHARP_EXPORT ExceptionInfo* FileReader_NumRowGroups(const std::shared_ptr<FileReader>* reader, int* num_row_groups)
   {
-    TRYCATCH(*num_row_groups = reader->num_row_groups();)
+    TRYCATCH(*num_row_groups = (*reader)->num_row_groups();)
   }
 
   PARQUETSHARP_EXPORT ExceptionInfo* FileReader_GetRecordBatchReader(
-      FileReader* reader,
+      const std::shared_ptr<FileReader>* reader,
       const int32_t* row_groups,
       int32_t row_groups_count,
       const int32_t* columns,
@@ -90,7 +96,7 @@ extern "C"
       std::vector<int> row_groups_vec;
       if (row_groups == nullptr)
       {
-        row_groups_vec.resize(reader->num_row_groups());
+        row_groups_vec.resize((*reader)->num_row_groups());
         std::iota(row_groups_vec.begin(), row_groups_vec.end(), 0);
       }
       else
@@ -100,33 +106,33 @@ extern "C"
       }
       if (columns == nullptr)
       {
-        PARQUET_ASSIGN_OR_THROW(batch_reader, reader->GetRecordBatchReader(row_groups_vec));
+        PARQUET_ASSIGN_OR_THROW(batch_reader, (*reader)->GetRecordBatchReader(row_groups_vec));
       }
       else
       {
         std::vector<int> columns_vec(columns_count);
         std::copy(columns, columns + columns_count, columns_vec.begin());
-        PARQUET_ASSIGN_OR_THROW(batch_reader, reader->GetRecordBatchReader(row_groups_vec, columns_vec));
+        PARQUET_ASSIGN_OR_THROW(batch_reader, (*reader)->GetRecordBatchReader(row_groups_vec, columns_vec));
       }
       PARQUET_THROW_NOT_OK(arrow::ExportRecordBatchReader(batch_reader, stream_out));
     )
   }
 
   PARQUETSHARP_EXPORT ExceptionInfo* FileReader_ParquetReader(
-      FileReader* reader,
+      const std::shared_ptr<FileReader>* reader,
       parquet::ParquetFileReader** parquet_reader)
   {
-    TRYCATCH(*parquet_reader = reader->parquet_reader();)
+    TRYCATCH(*parquet_reader = (*reader)->parquet_reader();)
   }
 
   PARQUETSHARP_EXPORT ExceptionInfo* FileReader_Manifest(
-      FileReader* reader,
+      const std::shared_ptr<FileReader>* reader,
       const SchemaManifest** manifest)
   {
-    TRYCATCH(*manifest = &(reader->manifest());)
+    TRYCATCH(*manifest = &((*reader)->manifest());)
   }
 
-  PARQUETSHARP_EXPORT void FileReader_Free(FileReader* reader)
+  PARQUETSHARP_EXPORT void FileReader_Free(const std::shared_ptr<FileReader>* reader)
   {
     delete reader;
   }
@@ -3,6 +3,7 @@
 #include <arrow/c/bridge.h>
 #include <arrow/record_batch.h>
 #include <arrow/table.h>
+#include <arrow/util/byte_size.h>
 #include <parquet/arrow/writer.h>
 
 #include "cpp/ParquetSharpExport.h"
@@ -117,6 +118,18 @@ extern "C"
     )
   }
 
+  // Get the total size of the buffer ranges referenced by a record batch, which accounts for slicing
+  PARQUETSHARP_EXPORT ExceptionInfo* FileWriter_ReferencedBufferSize(
+      struct ArrowArray* array, struct ArrowSchema* schema, int64_t* size)
+  {
+    TRYCATCH
+    (
+        std::shared_ptr<arrow::RecordBatch> batch;
+        PARQUET_ASSIGN_OR_THROW(batch, arrow::ImportRecordBatch(array, schema));
+        PARQUET_ASSIGN_OR_THROW(*size, arrow::util::ReferencedBufferSize(*batch));
+    )
+  }
+
   PARQUETSHARP_EXPORT ExceptionInfo* FileWriter_NewRowGroup(FileWriter* writer)
   {
     TRYCATCH(PARQUET_THROW_NOT_OK(writer->NewRowGroup());)
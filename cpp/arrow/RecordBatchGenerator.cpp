@@ -0,0 +1,140 @@
+#include <numeric>
+#include <arrow/c/abi.h>
+#include <arrow/c/bridge.h>
+#include <arrow/record_batch.h>
+#include <arrow/util/async_generator.h>
+#include <arrow/util/thread_pool.h>
+#include <parquet/arrow/reader.h>
+
+#include "cpp/ParquetSharpExport.h"
+#include "../ExceptionInfo.h"
+
+using namespace parquet::arrow;
+
+// Called when the next record batch is available.
+// At the end of the stream, array is null. On error, array is null and error is set.
+// The schema is only exported with the first batch.
+typedef void (*NextBatchCallback)(struct ArrowArray* array, struct ArrowSchema* schema, const char* error);
+
+// Called once the generator and all reads it started, including reads ahead of the requested batch,
+// have released the file reader. This is also called if creating the generator fails.
+typedef void (*ReleasedCallback)();
+
+struct RecordBatchGenerator
+{
+  ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> generator;
+  bool schema_exported = false;
+};
+
+namespace
+{
+  void ReleaseIfNotImported(struct ArrowArray* array, struct ArrowSchema* schema)
+  {
+    if (array->release != nullptr)
+    {
+      array->release(array);
+    }
+    if (schema->release != nullptr)
+    {
+      schema->release(schema);
+    }
+  }
+}
+
+extern "C"
+{
+  PARQUETSHARP_EXPORT ExceptionInfo* RecordBatchGenerator_Create(
+      const std::shared_ptr<FileReader>* reader,
+      const int32_t* row_groups,
+      int32_t row_groups_count,
+      const int32_t* columns,
+      int32_t columns_count,
+      int64_t rows_to_readahead,
+      const ReleasedCallback released,
+      RecordBatchGenerator** generator)
+  {
+    TRYCATCH
+    (
+      // Share ownership of the reader through a pointer that reports when it is no longer used,
+      // so that a managed input file can be kept alive until reads in flight have finished.
+      // The reader itself is released first, in case that closes the input file.
+      const std::shared_ptr<FileReader> tracked_reader(
+          reader->get(),
+          [owner = *reader, released](FileReader*) mutable
+          {
+            owner.reset();
+            released();
+          });
+
+      std::vector<int> row_groups_vec;
+      if (row_groups == nullptr)
+      {
+        row_groups_vec.resize((*reader)->num_row_groups());
+        std::iota(row_groups_vec.begin(), row_groups_vec.end(), 0);
+      }
+      else
+      {
+        row_groups_vec.assign(row_groups, row_groups + row_groups_count);
+      }
+      std::vector<int> columns_vec;
+      if (columns == nullptr)
+      {
+        columns_vec.resize((*reader)->parquet_reader()->metadata()->num_columns());
+        std::iota(columns_vec.begin(), columns_vec.end(), 0);
+      }
+      else
+      {
+        columns_vec.assign(columns, columns + columns_count);
+      }
+
+      // Decoding runs on the CPU thread pool, so requesting the next batch never blocks the caller.
+      // The generator shares ownership of the reader, so reads in flight keep it alive.
+      PARQUET_ASSIGN_OR_THROW(auto batch_generator, tracked_reader->GetRecordBatchGenerator(
+          tracked_reader, row_groups_vec, columns_vec, ::arrow::internal::GetCpuThreadPool(), rows_to_readahead));
+      *generator = new RecordBatchGenerator{std::move(batch_generator)};
+    )
+  }
+
+  PARQUETSHARP_EXPORT ExceptionInfo* RecordBatchGenerator_Next(RecordBatchGenerator* generator, const NextBatchCallback callback)
+  {
+    TRYCATCH
+    (
+      const bool export_schema = !generator->schema_exported;
+      generator->schema_exported = true;
+
+      generator->generator().AddCallback(
+        [callback, export_schema](const ::arrow::Result<std::shared_ptr<::arrow::RecordBatch>>& result)
+        {
+          if (!result.ok())
+          {
+            callback(nullptr, nullptr, result.status().ToString().c_str());
+            return;
+          }
+
+          const auto& batch = *result;
+          if (::arrow::IsIterationEnd(batch))
+          {
+            callback(nullptr, nullptr, nullptr);
+            return;
+          }
+
+          struct ArrowArray array{};
+          struct ArrowSchema schema{};
+          const auto status = ::arrow::ExportRecordBatch(*batch, &array, export_schema ? &schema : nullptr);
+          if (!status.ok())
+          {
+            callback(nullptr, nullptr, status.ToString().c_str());
+            return;
+          }
+
+          callback(&array, export_schema ? &schema : nullptr, nullptr);
+          ReleaseIfNotImported(&array, &schema);
+        });
+    )
+  }
+
+  PARQUETSHARP_EXPORT void RecordBatchGenerator_Free(RecordBatchGenerator* generator)
+  {
+    delete generator;
+  }
+}
@@ -67,6 +67,7 @@ namespace ParquetSharp.Benchmark
                     BenchmarkConverter.TypeToBenchmarks(typeof(FloatArrayTimeSeriesRead), config),
                     BenchmarkConverter.TypeToBenchmarks(typeof(NestedRead), config),
                     BenchmarkConverter.TypeToBenchmarks(typeof(NestedWrite), config),
+                    BenchmarkConverter.TypeToBenchmarks(typeof(WideFloatRead), config),
                 });
 
                 // Re-print to the console all the summaries. 
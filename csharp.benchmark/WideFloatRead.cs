@@ -0,0 +1,136 @@
+﻿using System;
+using System.Diagnostics;
+using System.Linq;
+using BenchmarkDotNet.Attributes;
+
+namespace ParquetSharp.Benchmark
+{
+    /// <summary>
+    /// Reads many float columns in small batches, where the per-column overhead of native calls dominates.
+    /// </summary>
+    [MemoryDiagnoser]
+    public class WideFloatRead
+    {
+        public WideFloatRead()
+        {
+            Console.WriteLine("Writing data...");
+
+            var timer = Stopwatch.StartNew();
+            var rand = new Random(123);
+
+            _numRows = DataConfig.Size == DataSize.Small ? 10_000 : 100_000;
+            var values = Enumerable.Range(0, NumColumns)
+                .Select(_ => Enumerable.Range(0, _numRows).Select(i => (float) rand.NextDouble()).ToArray())
+                .ToArray();
+            _expectedSums = values.Select(columnValues => Sum(0f, columnValues)).ToArray();
+
+            var columns = Enumerable.Range(0, NumColumns).Select(c => (Column) new Column<float>($"Value{c}")).ToArray();
+            using (var fileWriter = new ParquetFileWriter(Filename, columns, Compression.Snappy))
+            {
+                using var rowGroupWriter = fileWriter.AppendRowGroup();
+                foreach (var columnValues in values)
+                {
+                    using var valueWriter = rowGroupWriter.NextColumn().LogicalWriter<float>();
+                    valueWriter.WriteBatch(columnValues);
+                }
+
+                fileWriter.Close();
+            }
+
+            Console.WriteLine("Wrote {0:N0} rows of {1:N0} columns in {2:N2} sec", _numRows, NumColumns, timer.Elapsed.TotalSeconds);
+            Console.WriteLine();
+        }
+
+        [Benchmark(Baseline = true)]
+        public float[] ColumnReaderReadBatch()
+        {
+            using var fileReader = new ParquetFileReader(Filename);
+            using var groupReader = fileReader.RowGroup(0);
+
+            var columnReaders = Enumerable.Range(0, NumColumns).Select(c => (ColumnReader<float>) groupReader.Column(c)).ToArray();
+            var values = new float[BatchSize];
+            var sums = new float[NumColumns];
+
+            for (var rowsRead = 0L; rowsRead < _numRows;)
+            {
+                var batchRows = 0L;
+                for (var c = 0; c != NumColumns; ++c)
+                {
+                    var columnReader = columnReaders[c];
+                    var levelsRead = 0L;
+                    while (levelsRead < BatchSize && columnReader.HasNext)
+                    {
+                        levelsRead += columnReader.ReadBatch(BatchSize - levelsRead, values.AsSpan((int) levelsRead), out _);
+                    }
+                    sums[c] = Sum(sums[c], values.AsSpan(0, (int) levelsRead));
+                    batchRows = levelsRead;
+                }
+                rowsRead += batchRows;
+            }
+
+            foreach (var columnReader in columnReaders)
+            {
+                columnReader.Dispose();
+            }
+            fileReader.Close();
+
+            if (Check.Enabled)
+            {
+                Check.ArraysAreEqual(_expectedSums, sums);
+            }
+
+            return sums;
+        }
+
+        [Benchmark]
+        public float[] RowGroupReaderReadBatches()
+        {
+            using var fileReader = new ParquetFileReader(Filename);
+            using var groupReader = fileReader.RowGroup(0);
+
+            var columnReaders = Enumerable.Range(0, NumColumns).Select(c => (ColumnReader<float>) groupReader.Column(c)).ToArray();
+            var sums = new float[NumColumns];
+
+            using (var batch = new MultiColumnBatch<float>(columnReaders, BatchSize))
+            {
+                for (var rowsRead = 0L; rowsRead < _numRows; rowsRead += batch.LevelsRead(0))
+                {
+                    groupReader.ReadBatches(batch);
+                    for (var c = 0; c != NumColumns; ++c)
+                    {
+                        sums[c] = Sum(sums[c], batch.Values(c));
+                    }
+                }
+            }
+
+            foreach (var columnReader in columnReaders)
+            {
+                columnReader.Dispose();
+            }
+            fileReader.Close();
+
+            if (Check.Enabled)
+            {
+                Check.ArraysAreEqual(_expectedSums, sums);
+            }
+
+            return sums;
+        }
+
+        private static float Sum(float sum, ReadOnlySpan<float> values)
+        {
+            foreach (var value in values)
+            {
+                sum += value;
+            }
+            return sum;
+        }
+
+        private const string Filename = "wide_float.parquet";
+        private const int NumColumns = 300;
+        private const int BatchSize = 64;
+
+        private readonly int _numRows;
+        private readonly float[] _expectedSums;
+    }
+}
@@ -1,6 +1,8 @@
 using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
+using System.Threading;
 using System.Threading.Tasks;
 using Apache.Arrow;
 using Apache.Arrow.Types;
@@ -35,6 +37,41 @@ namespace ParquetSharp.Test.Arrow
             Assert.That(schema.FieldsList[2].DataType.TypeId, Is.EqualTo(ArrowTypeId.Float));
         }
 
+        [TestCase(false)]
+        [TestCase(true)]
+        public async Task TestReadFromPath(bool memoryMap)
+        {
+            using var tempDir = new TempWorkingDirectory();
+            var path = System.IO.Path.Combine(tempDir.DirectoryPath, "test.parquet");
+            using (var buffer = new ResizableBuffer())
+            {
+                WriteTestFile(buffer);
+                System.IO.File.WriteAllBytes(path, buffer.ToArray());
+            }
+
+            using var fileReader = new FileReader(path, memoryMap);
+            using var batchReader = fileReader.GetRecordBatchReader();
+
+            int rowsRead = 0;
+            while (true)
+            {
+                using var batch = await batchReader.ReadNextRecordBatchAsync();
+                if (batch == null)
+                {
+                    break;
+                }
+
+                var idValues = (Int32Array) batch.Column("ObjectId");
+                for (var i = 0; i < batch.Length; ++i)
+                {
+                    Assert.That(idValues.GetValue(i), Is.EqualTo(rowsRead + i));
+                }
+                rowsRead += batch.Length;
+            }
+
+            Assert.That(rowsRead, Is.EqualTo(RowsPerRowGroup * NumRowGroups));
+        }
+
         [Test]
         public async Task TestReadBatches()
         {
@@ -196,6 +233,135 @@ namespace ParquetSharp.Test.Arrow
             Assert.That(rowsRead, Is.EqualTo(RowsPerRowGroup * NumRowGroups));
         }
 
+#if NET5_0_OR_GREATER
+        [TestCase(0)]
+        [TestCase(RowsPerRowGroup * 2)]
+        public async Task TestReadBatchesAsync(long rowsToReadahead)
+        {
+            using var buffer = new ResizableBuffer();
+            WriteTestFile(buffer);
+
+            using var inStream = new BufferReader(buffer);
+            using var arrowProperties = ArrowReaderProperties.GetDefault();
+            arrowProperties.PreBuffer = true;
+            using var fileReader = new FileReader(inStream, arrowProperties: arrowProperties);
+
+            int rowsRead = 0;
+            await foreach (var batch in fileReader.GetRecordBatchesAsync(rowsToReadahead: rowsToReadahead))
+            {
+                using (batch)
+                {
+                    Assert.That(batch.Schema.FieldsList.Count, Is.EqualTo(3));
+                    var idValues = (Int32Array) batch.Column("ObjectId");
+                    var valueValues = (FloatArray) batch.Column("Value");
+                    for (var i = 0; i < batch.Length; ++i)
+                    {
+                        var row = rowsRead + i;
+                        Assert.That(idValues.GetValue(i), Is.EqualTo(row));
+                        Assert.That(valueValues.GetValue(i), Is.EqualTo(row / 100.0f));
+                    }
+                    rowsRead += batch.Length;
+                }
+            }
+
+            Assert.That(rowsRead, Is.EqualTo(RowsPerRowGroup * NumRowGroups));
+        }
+
+        [Test]
+        public async Task TestReadBatchesAsyncSelectedRowGroupsAndColumns()
+        {
+            using var buffer = new ResizableBuffer();
+            WriteTestFile(buffer);
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new FileReader(inStream);
+
+            int rowsRead = 0;
+            await foreach (var batch in fileReader.GetRecordBatchesAsync(rowGroups: new[] {1, 2}, columns: new[] {1}))
+            {
+                using (batch)
+                {
+                    Assert.That(batch.Schema.FieldsList.Select(f => f.Name).ToArray(), Is.EqualTo(new[] {"ObjectId"}));
+                    var idValues = (Int32Array) batch.Column("ObjectId");
+                    for (var i = 0; i < batch.Length; ++i)
+                    {
+                        Assert.That(idValues.GetValue(i), Is.EqualTo(RowsPerRowGroup + rowsRead + i));
+                    }
+                    rowsRead += batch.Length;
+                }
+            }
+
+            Assert.That(rowsRead, Is.EqualTo(RowsPerRowGroup * 2));
+        }
+
+        [Test]
+        public async Task TestReadBatchesAsyncEarlyExit()
+        {
+            using var buffer = new ResizableBuffer();
+            WriteTestFile(buffer);
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new FileReader(inStream);
+
+            // Stop while following row groups are still being read ahead
+            await foreach (var batch in fileReader.GetRecordBatchesAsync(rowsToReadahead: RowsPerRowGroup * NumRowGroups))
+            {
+                batch.Dispose();
+                break;
+            }
+
+            using var cancellation = new CancellationTokenSource();
+            cancellation.Cancel();
+            Assert.ThrowsAsync<OperationCanceledException>(async () =>
+            {
+                await foreach (var batch in fileReader.GetRecordBatchesAsync(cancellationToken: cancellation.Token))
+                {
+                    batch.Dispose();
+                }
+            });
+        }
+
+        [Test]
+        public async Task TestReadBatchesAsyncEarlyExitWaitsForReadahead()
+        {
+            using var buffer = new ResizableBuffer();
+            WriteTestFile(buffer);
+            var bytes = buffer.ToArray();
+
+            var enumerationCompleted = false;
+            var readsAfterCompletion = 0;
+            var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: (position, destination) =>
+            {
+                if (Volatile.Read(ref enumerationCompleted))
+                {
+                    Interlocked.Increment(ref readsAfterCompletion);
+                }
+                // Slow down reads so that following row groups are still being read when enumeration stops
+                Thread.Sleep(10);
+                var length = Math.Max(0, Math.Min(destination.Length, bytes.Length - (int) position));
+                bytes.AsSpan((int) position, length).CopyTo(destination);
+                return length;
+            });
+
+            using (var fileReader = new FileReader(input))
+            {
+                await foreach (var batch in fileReader.GetRecordBatchesAsync(rowsToReadahead: RowsPerRowGroup * NumRowGroups))
+                {
+                    batch.Dispose();
+                    break;
+                }
+                Volatile.Write(ref enumerationCompleted, true);
+            }
+            input.Dispose();
+
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+            await Task.Delay(100);
+
+            Assert.That(readsAfterCompletion, Is.EqualTo(0));
+        }
+#endif
+
         [Test]
         public void TestAccessUnderlyingReader()
         {
@@ -210,6 +210,117 @@ namespace ParquetSharp.Test.Arrow
             }
         }
 
+        [Test]
+        public void TestWriteBufferedRecordBatchesWithMaxRowGroupBytes()
+        {
+            // Each batch has 12 kB of data
+            const int batchSize = 1000;
+            const long maxRowGroupBytes = 30_000;
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var writer = new FileWriter(outStream, SizedBatchSchema);
+
+                for (var batch = 0; batch != 5; ++batch)
+                {
+                    using var recordBatch = GetSizedBatch(batch * batchSize, batchSize);
+                    writer.WriteBufferedRecordBatch(recordBatch, maxRowGroupBytes);
+                }
+
+                // Explicitly starting a row group resets the size of the current row group
+                writer.NewBufferedRowGroup();
+                using (var recordBatch = GetSizedBatch(5 * batchSize, batchSize))
+                {
+                    writer.WriteBufferedRecordBatch(recordBatch, maxRowGroupBytes);
+                }
+
+                writer.Close();
+            }
+
+            Assert.That(GetRowGroupSizes(buffer), Is.EqualTo(new long[] { 2000, 2000, 1000, 1000 }));
+        }
+
+        [Test]
+        public void TestWriteBufferedRecordBatchesWithAndWithoutMaxRowGroupBytes()
+        {
+            const int batchSize = 1000;
+            const long maxRowGroupBytes = 30_000;
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var writer = new FileWriter(outStream, SizedBatchSchema);
+
+                // The size of data written without a target size isn't known, so the next sized write starts a new row group
+                using (var recordBatch = GetSizedBatch(0, batchSize))
+                {
+                    writer.WriteBufferedRecordBatch(recordBatch);
+                }
+                for (var batch = 1; batch != 4; ++batch)
+                {
+                    using var recordBatch = GetSizedBatch(batch * batchSize, batchSize);
+                    writer.WriteBufferedRecordBatch(recordBatch, maxRowGroupBytes);
+                }
+
+                writer.Close();
+            }
+
+            Assert.That(GetRowGroupSizes(buffer), Is.EqualTo(new long[] { 1000, 2000, 1000 }));
+        }
+
+        [Test]
+        public void TestWriteBufferedSlicedRecordBatchesWithMaxRowGroupBytes()
+        {
+            // Slices only count the 12 kB of data they reference, not the 120 kB of the whole batch
+            const int batchSize = 1000;
+            const long maxRowGroupBytes = 30_000;
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var writer = new FileWriter(outStream, SizedBatchSchema);
+
+                using var recordBatch = GetSizedBatch(0, 10 * batchSize);
+                for (var batch = 0; batch != 10; ++batch)
+                {
+                    using var slice = recordBatch.Slice(batch * batchSize, batchSize);
+                    writer.WriteBufferedRecordBatch(slice, maxRowGroupBytes);
+                }
+
+                writer.Close();
+            }
+
+            Assert.That(GetRowGroupSizes(buffer), Is.EqualTo(new long[] { 2000, 2000, 2000, 2000, 2000 }));
+        }
+
+        [Test]
+        public void TestWriteBufferedRecordBatchesWithMaxRowGroupBytesAndLength()
+        {
+            const int batchSize = 1000;
+            const long maxRowGroupBytes = 30_000;
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var propertiesBuilder = new WriterPropertiesBuilder();
+                propertiesBuilder.MaxRowGroupLength(1500);
+                using var writerProperties = propertiesBuilder.Build();
+                using var writer = new FileWriter(outStream, SizedBatchSchema, writerProperties);
+
+                for (var batch = 0; batch != 5; ++batch)
+                {
+                    using var recordBatch = GetSizedBatch(batch * batchSize, batchSize);
+                    writer.WriteBufferedRecordBatch(recordBatch, maxRowGroupBytes);
+                }
+
+                writer.Close();
+            }
+
+            // Row groups started by the writer on reaching MaxRowGroupLength only count the rows written to them
+            Assert.That(GetRowGroupSizes(buffer), Is.EqualTo(new long[] { 1500, 1500, 1500, 500 }));
+        }
+
         [Test]
         public async Task TestWriteRowGroupColumns()
         {
@@ -369,6 +480,40 @@ namespace ParquetSharp.Test.Arrow
             }
         }
 
+        private static readonly Apache.Arrow.Schema SizedBatchSchema = new(new[]
+        {
+            new Field("x", new Apache.Arrow.Types.Int32Type(), false),
+            new Field("y", new Apache.Arrow.Types.DoubleType(), false),
+        }, null);
+
+        private static RecordBatch GetSizedBatch(int start, int numRows)
+        {
+            var arrays = new IArrowArray[]
+            {
+                new Int32Array.Builder()
+                    .AppendRange(Enumerable.Range(start, numRows))
+                    .Build(),
+                new DoubleArray.Builder()
+                    .AppendRange(Enumerable.Range(start, numRows).Select(i => i / 100.0))
+                    .Build(),
+            };
+            return new RecordBatch(SizedBatchSchema, arrays, numRows);
+        }
+
+        private static long[] GetRowGroupSizes(ResizableBuffer buffer)
+        {
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new FileReader(inStream);
+            using var parquetReader = fileReader.ParquetReader;
+            return Enumerable.Range(0, fileReader.NumRowGroups)
+                .Select(i =>
+                {
+                    using var rowGroupReader = parquetReader.RowGroup(i);
+                    return rowGroupReader.MetaData.NumRows;
+                })
+                .ToArray();
+        }
+
         private static async Task VerifyData(RandomAccessFile inStream, int expectedRows)
         {
             using var fileReader = new FileReader(inStream);
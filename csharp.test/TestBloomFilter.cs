@@ -0,0 +1,144 @@
+using System;
+using System.Linq;
+using NUnit.Framework;
+using ParquetSharp.IO;
+
+namespace ParquetSharp.Test
+{
+    [TestFixture]
+    internal static class TestBloomFilter
+    {
+        [Test]
+        public static void TestMightContain()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            var bloomFilterReader = fileReader.GetBloomFilterReader();
+            using var rowGroupBloomFilters = bloomFilterReader.RowGroup(0);
+            Assert.IsNotNull(rowGroupBloomFilters);
+
+            using var idFilter = rowGroupBloomFilters!.GetColumnBloomFilter(0);
+            using var nameFilter = rowGroupBloomFilters.GetColumnBloomFilter(1);
+            using var valueFilter = rowGroupBloomFilters.GetColumnBloomFilter(2);
+
+            Assert.IsNotNull(idFilter);
+            Assert.IsNotNull(nameFilter);
+            Assert.IsNull(valueFilter);
+            Assert.AreEqual(PhysicalType.Int64, idFilter!.PhysicalType);
+            Assert.AreEqual(PhysicalType.ByteArray, nameFilter!.PhysicalType);
+            Assert.That(idFilter.BitsetSize, Is.GreaterThan(0));
+
+            foreach (var id in Ids)
+            {
+                Assert.IsTrue(idFilter.MightContain(id));
+            }
+            foreach (var name in Names)
+            {
+                Assert.IsTrue(nameFilter.MightContain(name));
+            }
+
+            // With the requested false positive probability almost all missing values should be rejected
+            var missingIds = Enumerable.Range(0, 1000).Select(i => (long) NumRows * 2 + i).ToArray();
+            Assert.That(missingIds.Count(idFilter.MightContain), Is.LessThan(50));
+            Assert.That(missingIds.Count(i => nameFilter.MightContain($"missing_{i}")), Is.LessThan(50));
+        }
+
+        [Test]
+        public static void TestBatchProbe()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupBloomFilters = fileReader.GetBloomFilterReader().RowGroup(0);
+            using var idFilter = rowGroupBloomFilters!.GetColumnBloomFilter(0)!;
+            using var nameFilter = rowGroupBloomFilters.GetColumnBloomFilter(1)!;
+
+            var keys = Enumerable.Range(0, 2 * NumRows).Select(i => (long) i * 3).ToArray();
+            var found = new bool[keys.Length];
+            idFilter.MightContain(keys, found);
+            for (var i = 0; i != keys.Length; ++i)
+            {
+                Assert.AreEqual(idFilter.MightContain(keys[i]), found[i]);
+            }
+
+            var hashes = new ulong[keys.Length];
+            var foundFromHashes = new bool[keys.Length];
+            idFilter.Hash(keys, hashes);
+            idFilter.FindHashes(hashes, foundFromHashes);
+            Assert.AreEqual(found, foundFromHashes);
+
+            var nameKeys = keys.Select(k => $"name_{k}").ToArray();
+            var nameFound = new bool[nameKeys.Length];
+            var nameBytesFound = new bool[nameKeys.Length];
+            nameFilter.MightContain(nameKeys, nameFound);
+            nameFilter.MightContain(nameKeys.Select(k => System.Text.Encoding.UTF8.GetBytes(k)).ToArray(), nameBytesFound);
+            Assert.AreEqual(nameFound, nameBytesFound);
+            for (var i = 0; i != nameKeys.Length; ++i)
+            {
+                Assert.AreEqual(nameFilter.MightContain(nameKeys[i]), nameFound[i]);
+                if (keys[i] < NumRows)
+                {
+                    Assert.IsTrue(nameFound[i]);
+                }
+            }
+        }
+
+        [Test]
+        public static void TestMismatchedType()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupBloomFilters = fileReader.GetBloomFilterReader().RowGroup(0);
+            using var idFilter = rowGroupBloomFilters!.GetColumnBloomFilter(0)!;
+
+            Assert.Throws<ArgumentException>(() => idFilter.MightContain(1));
+            Assert.Throws<ArgumentException>(() => idFilter.MightContain("1"));
+            Assert.Throws<ArgumentException>(() => idFilter.MightContain(new long[2], new bool[1]));
+        }
+
+        private static ResizableBuffer WriteFile()
+        {
+            var columns = new Column[]
+            {
+                new Column<long>("id"),
+                new Column<string>("name"),
+                new Column<double>("value"),
+            };
+
+            using var builder = new WriterPropertiesBuilder();
+            builder
+                .EnableBloomFilter("id", new BloomFilterOptions(NumRows, 0.01))
+                .EnableBloomFilter("name", new BloomFilterOptions(NumRows, 0.01));
+            using var writerProperties = builder.Build();
+
+            var buffer = new ResizableBuffer();
+            using var output = new BufferOutputStream(buffer);
+            using var fileWriter = new ParquetFileWriter(output, columns, writerProperties);
+            using var rowGroupWriter = fileWriter.AppendRowGroup();
+
+            using (var idWriter = rowGroupWriter.NextColumn().LogicalWriter<long>())
+            {
+                idWriter.WriteBatch(Ids);
+            }
+
+            using (var nameWriter = rowGroupWriter.NextColumn().LogicalWriter<string>())
+            {
+                nameWriter.WriteBatch(Names);
+            }
+
+            using (var valueWriter = rowGroupWriter.NextColumn().LogicalWriter<double>())
+            {
+                valueWriter.WriteBatch(Ids.Select(i => i * 0.5).ToArray());
+            }
+
+            fileWriter.Close();
+            return buffer;
+        }
+
+        private const int NumRows = 1000;
+        private static readonly long[] Ids = Enumerable.Range(0, NumRows).Select(i => (long) i).ToArray();
+        private static readonly string[] Names = Ids.Select(i => $"name_{i}").ToArray();
+    }
+}
@@ -1,4 +1,7 @@
 ﻿using System;
+using System.Buffers;
+using System.Collections.Generic;
+using System.IO;
 using System.Linq;
 using System.Runtime.InteropServices;
 using ParquetSharp.IO;
@@ -100,5 +103,99 @@ namespace ParquetSharp.Test
             Marshal.Copy(buffer.Data, readValues, 0, newLength);
             Assert.That(readValues, Is.EqualTo(values));
         }
+
+        [Test]
+        public static void TestParquetWriteToBufferWriter()
+        {
+            var expected = Enumerable.Range(0, 1024 * 1024).ToArray();
+
+            // Use small segments so that writes are split across multiple spans
+            var bufferWriter = new SegmentedBufferWriter(segmentSize: 4096);
+            using (var outStream = new BufferWriterOutputStream(bufferWriter))
+            {
+                using var fileWriter = new ParquetFileWriter(outStream, new Column[] { new Column<int>("int_field") });
+                using (var rowGroupWriter = fileWriter.AppendRowGroup())
+                {
+                    using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<int>();
+                    colWriter.WriteBatch(expected);
+                }
+                fileWriter.Close();
+
+                Assert.AreEqual(bufferWriter.Length, outStream.Position);
+            }
+
+            using var fileReader = new ParquetFileReader(new MemoryStream(bufferWriter.ToArray()));
+            using var rowGroup = fileReader.RowGroup(0);
+            using var columnReader = rowGroup.Column(0).LogicalReader<int>();
+
+            var allData = columnReader.ReadAll((int) rowGroup.MetaData.NumRows);
+            Assert.AreEqual(expected, allData);
+        }
+
+        [Test]
+        public static void TestBufferWriterException()
+        {
+            var exception = Assert.Throws<ParquetException>(() =>
+            {
+                using var outStream = new BufferWriterOutputStream(new SegmentedBufferWriter(segmentSize: 4096, maxLength: 1024));
+                using var fileWriter = new ParquetFileWriter(outStream, new Column[] { new Column<int>("int_field") });
+                using (var rowGroupWriter = fileWriter.AppendRowGroup())
+                {
+                    using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<int>();
+                    colWriter.WriteBatch(Enumerable.Range(0, 1024).ToArray());
+                }
+                fileWriter.Close();
+            });
+
+            Assert.That(exception?.Message, Does.Contain("buffer writer is full"));
+        }
+
+        /// <summary>
+        /// A buffer writer that returns fixed size segments, similar to a pipe.
+        /// </summary>
+        private sealed class SegmentedBufferWriter : IBufferWriter<byte>
+        {
+            public SegmentedBufferWriter(int segmentSize, long maxLength = long.MaxValue)
+            {
+                _segmentSize = segmentSize;
+                _maxLength = maxLength;
+            }
+
+            public long Length { get; private set; }
+
+            public void Advance(int count)
+            {
+                _position += count;
+                Length += count;
+            }
+
+            public Memory<byte> GetMemory(int sizeHint = 0)
+            {
+                if (Length >= _maxLength)
+                {
+                    throw new IOException("buffer writer is full");
+                }
+
+                if (_segments.Count == 0 || _position == _segmentSize)
+                {
+                    _segments.Add(new byte[_segmentSize]);
+                    _position = 0;
+                }
+
+                return _segments[_segments.Count - 1].AsMemory(_position);
+            }
+
+            public Span<byte> GetSpan(int sizeHint = 0) => GetMemory(sizeHint).Span;
+
+            public byte[] ToArray()
+            {
+                return _segments.SelectMany(s => s).Take((int) Length).ToArray();
+            }
+
+            private readonly int _segmentSize;
+            private readonly long _maxLength;
+            private readonly List<byte[]> _segments = new();
+            private int _position;
+        }
     }
 }
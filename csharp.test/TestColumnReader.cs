@@ -1,4 +1,6 @@
 ﻿using System;
+using System.Collections.Generic;
+using System.IO;
 using System.Linq;
 using ParquetSharp.IO;
 using NUnit.Framework;
@@ -92,5 +94,244 @@ namespace ParquetSharp.Test
                 Assert.IsFalse(column.HasNext);
             }
         }
+
+        [Test]
+        public static void TestReadBatchWithDictionary()
+        {
+            var values = Enumerable.Range(0, 10_000).Select(i => i % 7 == 0 ? null : $"symbol_{i % 13}").ToArray();
+            using var buffer = WriteStrings(values, dictionaryPagesizeLimit: null);
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var column = (ColumnReader<ByteArray>) rowGroupReader.Column(0);
+
+            Assert.IsTrue(column.ColumnChunkMetaData.IsFullyDictionaryEncoded);
+
+            var defLevels = new short[1024];
+            var indices = new int[1024];
+            var read = new string?[values.Length];
+            var numRead = 0;
+
+            while (column.HasNext)
+            {
+                var levelsRead = (int) column.ReadBatchWithDictionary(1024, defLevels, Span<short>.Empty, indices, out var indicesRead, out var dictionary);
+                Assert.AreEqual(13, dictionary.Length);
+                Assert.AreEqual(defLevels.Take(levelsRead).Count(l => l == 1), indicesRead);
+
+                for (int i = 0, index = 0; i != levelsRead; ++i)
+                {
+                    read[numRead++] = defLevels[i] == 1 ? LogicalRead.ToString(dictionary[indices[index++]]) : null;
+                }
+            }
+
+            Assert.AreEqual(values, read);
+        }
+
+        [TestCase(null)]
+        [TestCase(256L)]
+        public static void TestLogicalReadDictionaryStrings(long? dictionaryPagesizeLimit)
+        {
+            var values = Enumerable.Range(0, 10_000).Select(i => i % 7 == 0 ? null : $"symbol_{i % 113}").ToArray();
+            using var buffer = WriteStrings(values, dictionaryPagesizeLimit);
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var column = rowGroupReader.Column(0);
+
+            // With a small dictionary page size limit, the writer falls back to plain encoding
+            Assert.AreEqual(dictionaryPagesizeLimit == null, column.ColumnChunkMetaData.IsFullyDictionaryEncoded);
+
+            using var logicalReader = column.LogicalReader<string?>(bufferLength: 1000);
+            var read = logicalReader.ReadAll(values.Length);
+
+            Assert.AreEqual(values, read);
+            Assert.IsFalse(logicalReader.HasNext);
+        }
+
+        [Test]
+        public static void TestReadBatches()
+        {
+            const int numColumns = 20;
+            const int numRows = 5_000;
+            var values = Enumerable.Range(0, numColumns).Select(c => Enumerable.Range(0, numRows).Select(i => (float?) (c * i)).ToArray()).ToArray();
+            for (var c = 0; c < numColumns; c += 2)
+            {
+                for (var i = c; i < numRows; i += 7)
+                {
+                    values[c][i] = null;
+                }
+            }
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                var columns = Enumerable.Range(0, numColumns).Select(c => c % 2 == 0 ? (Column) new Column<float?>($"c{c}") : new Column<float>($"c{c}")).ToArray();
+                using var builder = new WriterPropertiesBuilder();
+                using var writerProperties = builder.DataPagesize(1024).Build();
+                using var writer = new ParquetFileWriter(outStream, columns, writerProperties);
+                using var rowGroupWriter = writer.AppendRowGroup();
+                for (var c = 0; c != numColumns; ++c)
+                {
+                    using var colWriter = rowGroupWriter.NextColumn();
+                    if (c % 2 == 0)
+                    {
+                        using var logicalWriter = colWriter.LogicalWriter<float?>();
+                        logicalWriter.WriteBatch(values[c]);
+                    }
+                    else
+                    {
+                        using var logicalWriter = colWriter.LogicalWriter<float>();
+                        logicalWriter.WriteBatch(values[c].Select(v => v!.Value).ToArray());
+                    }
+                }
+                writer.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            var columnReaders = Enumerable.Range(0, numColumns).Select(c => (ColumnReader<float>) rowGroupReader.Column(c)).ToArray();
+            try
+            {
+                const int batchSize = 1_000;
+                using var batch = new MultiColumnBatch<float>(columnReaders, batchSize);
+                var read = Enumerable.Range(0, numColumns).Select(_ => new List<float?>()).ToArray();
+
+                Assert.AreEqual(numColumns, batch.NumColumns);
+                while (read[0].Count < numRows)
+                {
+                    rowGroupReader.ReadBatches(batch);
+
+                    for (var c = 0; c != numColumns; ++c)
+                    {
+                        // Reads continue across data pages
+                        Assert.AreEqual(Math.Min(batchSize, numRows - read[c].Count), batch.LevelsRead(c));
+                        Assert.AreEqual(batch.ValuesRead(c), batch.Values(c).Length);
+                        Assert.AreEqual(c % 2 == 0 ? batch.LevelsRead(c) : 0, batch.DefLevels(c).Length);
+                        Assert.AreEqual(0, batch.RepLevels(c).Length);
+
+                        var defLevels = batch.DefLevels(c);
+                        var batchValues = batch.Values(c);
+                        for (int i = 0, value = 0; i != batch.LevelsRead(c); ++i)
+                        {
+                            read[c].Add(defLevels.IsEmpty || defLevels[i] == 1 ? batchValues[value++] : null);
+                        }
+                    }
+                }
+
+                for (var c = 0; c != numColumns; ++c)
+                {
+                    Assert.AreEqual(values[c], read[c].ToArray());
+                    Assert.IsFalse(columnReaders[c].HasNext);
+                }
+
+                using var otherRowGroupReader = fileReader.RowGroup(0);
+                Assert.Throws<ArgumentException>(() => otherRowGroupReader.ReadBatches(batch));
+
+                // Readers of a row selection aren't supported
+                using var rangeReader = (ColumnReader<float>) rowGroupReader.Column(0, new[] {new RowRange(0, 10)});
+                Assert.Throws<ArgumentException>(() => new MultiColumnBatch<float>(new[] {rangeReader}, batchSize));
+
+                batch.Dispose();
+                Assert.Throws<ObjectDisposedException>(() => rowGroupReader.ReadBatches(batch));
+            }
+            finally
+            {
+                foreach (var columnReader in columnReaders)
+                {
+                    columnReader.Dispose();
+                }
+            }
+        }
+
+        [TestCase(0)]
+        [TestCase(1)]
+        [TestCase(4)]
+        public static void TestReadColumns(int numThreads)
+        {
+            const int numColumns = 16;
+            const int numRows = 10_000;
+            var values = Enumerable.Range(0, numColumns).Select(c => Enumerable.Range(0, numRows).Select(i => i % (c + 2) == 0 ? null : (double?) (c + i * 0.5)).ToArray()).ToArray();
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                var columns = Enumerable.Range(0, numColumns).Select(c => (Column) new Column<double?>($"c{c}")).ToArray();
+                using var builder = new WriterPropertiesBuilder();
+                using var writerProperties = builder.DataPagesize(4096).Build();
+                using var writer = new ParquetFileWriter(outStream, columns, writerProperties);
+                using var rowGroupWriter = writer.AppendRowGroup();
+                foreach (var columnValues in values)
+                {
+                    using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<double?>();
+                    colWriter.WriteBatch(columnValues);
+                }
+                writer.Close();
+            }
+
+            // Column chunks are read concurrently with a positional reader
+            var bytes = buffer.ToArray();
+            using var inStream = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: (position, destination) =>
+            {
+                var length = Math.Max(0, Math.Min(destination.Length, bytes.Length - (int) position));
+                bytes.AsSpan((int) position, length).CopyTo(destination);
+                return length;
+            });
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            var columnIndices = Enumerable.Range(0, numColumns).Reverse().ToArray();
+            var valueBuffers = columnIndices.Select(_ => new double[numRows]).ToArray();
+            var defLevels = columnIndices.Select(_ => new short[numRows]).ToArray();
+            var valuesRead = new long[numColumns];
+            var levelsRead = new long[numColumns];
+
+            rowGroupReader.ReadColumns(columnIndices, valueBuffers, defLevels, null, valuesRead, levelsRead, numThreads);
+
+            for (var i = 0; i != numColumns; ++i)
+            {
+                Assert.AreEqual(numRows, levelsRead[i]);
+                Assert.AreEqual(defLevels[i].Count(l => l == 1), valuesRead[i]);
+
+                var read = new double?[numRows];
+                for (int row = 0, value = 0; row != numRows; ++row)
+                {
+                    read[row] = defLevels[i][row] == 1 ? valueBuffers[i][value++] : null;
+                }
+                Assert.AreEqual(values[columnIndices[i]], read);
+            }
+
+            var smallBuffers = columnIndices.Select(_ => new double[numRows - 1]).ToArray();
+            var exception = Assert.Throws<ParquetException>(() => rowGroupReader.ReadColumns(columnIndices, smallBuffers, defLevels, null, valuesRead, levelsRead, numThreads));
+            Assert.That(exception!.Message, Does.Contain("too small"));
+            Assert.Throws<ArgumentException>(() => rowGroupReader.ReadColumns(columnIndices, columnIndices.Select(_ => new float[numRows]).ToArray(), defLevels, null, valuesRead, levelsRead, numThreads));
+        }
+
+        private static ResizableBuffer WriteStrings(string?[] values, long? dictionaryPagesizeLimit)
+        {
+            var schemaColumns = new Column[] {new Column<string?>("symbol")};
+
+            using var builder = new WriterPropertiesBuilder();
+            builder.DataPagesize(1024);
+            if (dictionaryPagesizeLimit != null)
+            {
+                builder.DictionaryPagesizeLimit(dictionaryPagesizeLimit.Value);
+            }
+            using var writerProperties = builder.Build();
+
+            var buffer = new ResizableBuffer();
+            using var outStream = new BufferOutputStream(buffer);
+            using var writer = new ParquetFileWriter(outStream, schemaColumns, writerProperties);
+            using var rowGroupWriter = writer.AppendRowGroup();
+            using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<string?>();
+
+            colWriter.WriteBatch(values);
+            writer.Close();
+
+            return buffer;
+        }
     }
 }
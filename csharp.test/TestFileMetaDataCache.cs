@@ -0,0 +1,216 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using NUnit.Framework;
+using ParquetSharp.IO;
+
+namespace ParquetSharp.Test
+{
+    [TestFixture]
+    internal static class TestFileMetaDataCache
+    {
+        [Test]
+        public static void TestOpenFile()
+        {
+            using var directory = new TempWorkingDirectory();
+            var path = Path.Combine(directory.DirectoryPath, "file.parquet");
+            WriteFile(path, new[] {1, 2, 3});
+
+            using var cache = new FileMetaDataCache(capacityBytes: 1024 * 1024);
+
+            using (var reader = cache.OpenFile(path))
+            {
+                Assert.AreEqual(3, reader.FileMetaData.NumRows);
+            }
+            Assert.AreEqual(1, cache.Count);
+
+            using (var reader = cache.OpenFile(path))
+            {
+                Assert.AreEqual(new[] {1, 2, 3}, ReadValues(reader));
+            }
+            Assert.AreEqual(1, cache.Count);
+
+            // Modifying the file invalidates the cached metadata
+            WriteFile(path, new[] {4, 5, 6, 7});
+            File.SetLastWriteTimeUtc(path, DateTime.UtcNow.AddMinutes(1));
+
+            using (var reader = cache.OpenFile(path))
+            {
+                Assert.AreEqual(new[] {4, 5, 6, 7}, ReadValues(reader));
+            }
+            Assert.AreEqual(2, cache.Count);
+
+            cache.Clear();
+            Assert.AreEqual(0, cache.Count);
+            Assert.AreEqual(0, cache.SizeBytes);
+        }
+
+        [Test]
+        public static void TestOpenSkipsFooterRead()
+        {
+            var bytes = WriteBytes(Enumerable.Range(0, 100).ToArray());
+            var lastModified = new DateTime(2024, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+            using var cache = new FileMetaDataCache(capacityBytes: 1024 * 1024);
+
+            int OpenAndCountReads()
+            {
+                var reads = 0;
+                using var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: (position, destination) =>
+                {
+                    Interlocked.Increment(ref reads);
+                    var length = Math.Max(0, Math.Min(destination.Length, bytes.Length - (int) position));
+                    bytes.AsSpan((int) position, length).CopyTo(destination);
+                    return length;
+                });
+                using var reader = cache.Open(input, "memory://file.parquet", bytes.Length, lastModified);
+                var readsBeforeData = reads;
+                Assert.AreEqual(Enumerable.Range(0, 100).ToArray(), ReadValues(reader));
+                return readsBeforeData;
+            }
+
+            Assert.That(OpenAndCountReads(), Is.GreaterThan(0));
+            Assert.AreEqual(0, OpenAndCountReads());
+        }
+
+        [Test]
+        public static void TestEviction()
+        {
+            using var directory = new TempWorkingDirectory();
+            var paths = Enumerable.Range(0, 4).Select(i => Path.Combine(directory.DirectoryPath, $"file{i}.parquet")).ToArray();
+            foreach (var path in paths)
+            {
+                WriteFile(path, new[] {1, 2, 3});
+            }
+
+            long footerSize;
+            using (var reader = new ParquetFileReader(paths[0]))
+            {
+                footerSize = reader.FileMetaData.Size;
+            }
+
+            using var cache = new FileMetaDataCache(capacityBytes: 2 * footerSize);
+            foreach (var path in paths)
+            {
+                using var reader = cache.OpenFile(path);
+                Assert.AreEqual(new[] {1, 2, 3}, ReadValues(reader));
+            }
+
+            Assert.AreEqual(2, cache.Count);
+            Assert.That(cache.SizeBytes, Is.LessThanOrEqualTo(cache.CapacityBytes));
+
+            // Metadata that doesn't fit in the cache isn't cached
+            using var emptyCache = new FileMetaDataCache(capacityBytes: 0);
+            using (var reader = emptyCache.OpenFile(paths[0]))
+            {
+                Assert.AreEqual(new[] {1, 2, 3}, ReadValues(reader));
+            }
+            Assert.AreEqual(0, emptyCache.Count);
+        }
+
+        [Test]
+        public static void TestOpenWithFileMetaData()
+        {
+            var bytes = WriteBytes(new[] {1, 2, 3});
+
+            using var firstReader = new ParquetFileReader(new MemoryStream(bytes));
+            using var input = new ManagedRandomAccessFile(new MemoryStream(bytes));
+            using var reader = new ParquetFileReader(input, null, firstReader.FileMetaData);
+
+            Assert.AreEqual(firstReader.FileMetaData, reader.FileMetaData);
+            Assert.AreEqual(new[] {1, 2, 3}, ReadValues(reader));
+        }
+
+        [TestCase(false)]
+        [TestCase(true)]
+        public static void TestEncryptedFileNotCached(bool plaintextFooter)
+        {
+            using var buffer = new ResizableBuffer();
+            using (var output = new BufferOutputStream(buffer))
+            {
+                using var encryptionBuilder = new FileEncryptionPropertiesBuilder(Key);
+                if (plaintextFooter)
+                {
+                    encryptionBuilder.SetPlaintextFooter();
+                }
+                using var fileEncryptionProperties = encryptionBuilder.Build();
+                using var propertiesBuilder = new WriterPropertiesBuilder();
+                using var writerProperties = propertiesBuilder.Encryption(fileEncryptionProperties).Build();
+                using var writer = new ParquetFileWriter(output, new Column[] {new Column<int>("values")}, writerProperties);
+                using (var groupWriter = writer.AppendRowGroup())
+                {
+                    using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                    columnWriter.WriteBatch(new[] {1, 2, 3});
+                }
+                writer.Close();
+            }
+
+            var lastModified = new DateTime(2024, 1, 1, 0, 0, 0, DateTimeKind.Utc);
+            using var cache = new FileMetaDataCache(capacityBytes: 1024 * 1024);
+
+            using var decryptionBuilder = new FileDecryptionPropertiesBuilder();
+            using var fileDecryptionProperties = decryptionBuilder.FooterKey(Key).Build();
+            using var readerProperties = ReaderProperties.GetDefaultReaderProperties();
+            readerProperties.FileDecryptionProperties = fileDecryptionProperties;
+
+            for (var i = 0; i != 2; ++i)
+            {
+                using var input = new BufferReader(buffer);
+                using var reader = cache.Open(input, "memory://encrypted.parquet", buffer.Size, lastModified, readerProperties);
+                Assert.AreEqual(new[] {1, 2, 3}, ReadValues(reader));
+            }
+            Assert.AreEqual(0, cache.Count);
+
+            // Encrypted files opened without decryption properties aren't cached either
+            if (plaintextFooter)
+            {
+                using (var input = new BufferReader(buffer))
+                {
+                    using var reader = cache.Open(input, "memory://encrypted.parquet", buffer.Size, lastModified);
+                    Assert.AreEqual(3, reader.FileMetaData.NumRows);
+                }
+                Assert.AreEqual(0, cache.Count);
+            }
+
+            // The metadata of an encrypted file can't be reused
+            using (var firstInput = new BufferReader(buffer))
+            {
+                using var firstReader = new ParquetFileReader(firstInput, readerProperties);
+                using var input = new BufferReader(buffer);
+
+                var exception = Assert.Throws<ArgumentException>(() => new ParquetFileReader(input, readerProperties, firstReader.FileMetaData));
+                Assert.That(exception?.Message, Does.Contain("decryption properties"));
+
+                exception = Assert.Throws<ArgumentException>(() => new ParquetFileReader(input, null, firstReader.FileMetaData));
+                Assert.That(exception?.Message, Does.Contain("encrypted file"));
+            }
+        }
+
+        private static void WriteFile(string path, int[] values)
+        {
+            File.WriteAllBytes(path, WriteBytes(values));
+        }
+
+        private static byte[] WriteBytes(int[] values)
+        {
+            using var buffer = new MemoryStream();
+            using (var writer = new ParquetFileWriter(buffer, new Column[] {new Column<int>("values")}, leaveOpen: true))
+            {
+                using var groupWriter = writer.AppendRowGroup();
+                using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                columnWriter.WriteBatch(values);
+                writer.Close();
+            }
+            return buffer.ToArray();
+        }
+
+        private static int[] ReadValues(ParquetFileReader reader)
+        {
+            using var groupReader = reader.RowGroup(0);
+            using var columnReader = groupReader.Column(0).LogicalReader<int>();
+            return columnReader.ReadAll((int) groupReader.MetaData.NumRows);
+        }
+
+        private static readonly byte[] Key = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    }
+}
@@ -1,7 +1,9 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.IO;
 using System.Linq;
 using System.Reflection;
+using System.Threading;
 using ParquetSharp.IO;
 using NUnit.Framework;
 using ParquetSharp.Schema;
@@ -43,6 +45,347 @@ namespace ParquetSharp.Test
                 "but the actual element type is 'System.Nullable`1[System.Int32]'."));
         }
 
+        [Test]
+        public static void TestReadDictionaryIndices()
+        {
+            var values = Enumerable.Range(0, 10_000).Select(i => i % 11 == 0 ? null : $"venue_{i % 17}").ToArray();
+            using var buffer = WriteStrings(values, disableDictionary: false);
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<string?>())
+            {
+                Assert.IsTrue(logicalReader.CanReadDictionaryIndices);
+
+                var dictionary = logicalReader.GetDictionary();
+                var indices = new int[values.Length];
+                var read = 0;
+                while (logicalReader.HasNext)
+                {
+                    read += logicalReader.ReadDictionaryIndices(indices.AsSpan(read, Math.Min(1000, values.Length - read)));
+                }
+
+                Assert.AreEqual(values.Length, read);
+                Assert.AreEqual(17, dictionary.Length);
+                Assert.AreEqual(values, indices.Select(i => i == -1 ? null : dictionary[i]).ToArray());
+            }
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<string?>())
+            {
+                logicalReader.Skip(5_000);
+                var indices = logicalReader.ReadAllDictionaryIndices(5_000, out var dictionary);
+
+                Assert.AreEqual(values.Skip(5_000).ToArray(), indices.Select(i => i == -1 ? null : dictionary[i]).ToArray());
+            }
+        }
+
+        [Test]
+        public static void TestReadDictionaryIndicesNotDictionaryEncoded()
+        {
+            var values = Enumerable.Range(0, 100).Select(i => $"venue_{i % 17}").ToArray();
+            using var buffer = WriteStrings(values, disableDictionary: true);
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var logicalReader = rowGroupReader.Column(0).LogicalReader<string?>();
+
+            Assert.IsFalse(logicalReader.CanReadDictionaryIndices);
+            Assert.Throws<InvalidOperationException>(() => logicalReader.ReadDictionaryIndices(new int[10]));
+            Assert.Throws<InvalidOperationException>(() => logicalReader.GetDictionary());
+            Assert.AreEqual(values, logicalReader.ReadAll(values.Length));
+        }
+
+        [Test]
+        public static void TestReadSpaced()
+        {
+            const int numRows = 10_000;
+            var values = Enumerable.Range(0, numRows).Select(i => i % 7 == 0 || i / 1000 == 3 ? (double?) null : i * 0.5).ToArray();
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var builder = new WriterPropertiesBuilder();
+                using var writerProperties = builder.DataPagesize(1024).Build();
+                using var writer = new ParquetFileWriter(outStream, new Column[] {new Column<double?>("value")}, writerProperties);
+                using var rowGroupWriter = writer.AppendRowGroup();
+                using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<double?>();
+                colWriter.WriteBatch(values);
+                writer.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<double?>())
+            {
+                var read = new double[numRows];
+                var validity = new ulong[(numRows + 63) / 64];
+                var numRead = 0;
+                while (logicalReader.HasNext)
+                {
+                    // Use a batch size that isn't a multiple of 64 to check bits are written at the right offset
+                    var batchSize = Math.Min(1000, numRows - numRead);
+                    var batchValidity = new ulong[(batchSize + 63) / 64];
+                    var rowsRead = logicalReader.ReadBatchSpaced(read.AsSpan(numRead, batchSize), batchValidity.AsSpan());
+                    for (var i = 0; i != rowsRead; ++i)
+                    {
+                        if ((batchValidity[i / 64] & (1UL << (i % 64))) != 0)
+                        {
+                            validity[(numRead + i) / 64] |= 1UL << ((numRead + i) % 64);
+                        }
+                    }
+                    numRead += rowsRead;
+                }
+
+                Assert.AreEqual(numRows, numRead);
+                Assert.AreEqual(values, Enumerable.Range(0, numRows).Select(i => (validity[i / 64] & (1UL << (i % 64))) != 0 ? read[i] : (double?) null).ToArray());
+                Assert.AreEqual(values.Select(v => v ?? 0.0).ToArray(), read);
+            }
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<double?>())
+            {
+                logicalReader.Skip(2_500);
+                var read = logicalReader.ReadAllSpaced<double>(numRows - 2_500, out var validity);
+
+                Assert.AreEqual(values.Skip(2_500).ToArray(), read.Select((v, i) => (validity[i / 64] & (1UL << (i % 64))) != 0 ? v : (double?) null).ToArray());
+            }
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<double?>())
+            {
+                Assert.Throws<ArgumentException>(() => logicalReader.ReadBatchSpaced<float>(new float[10], new ulong[1]));
+                Assert.Throws<ArgumentOutOfRangeException>(() => logicalReader.ReadBatchSpaced<double>(new double[100], new ulong[1]));
+            }
+        }
+
+        [Test]
+        public static void TestReadSpacedUnsupported()
+        {
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var writer = new ParquetFileWriter(outStream, new Column[] {new Column<int[]>("values"), new Column<DateTime?>("time"), new Column<string>("name")});
+                using var rowGroupWriter = writer.AppendRowGroup();
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<int[]>())
+                {
+                    colWriter.WriteBatch(new[] {new[] {1, 2}, new[] {3}});
+                }
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<DateTime?>())
+                {
+                    colWriter.WriteBatch(new DateTime?[] {null, DateTime.UtcNow});
+                }
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<string>())
+                {
+                    colWriter.WriteBatch(new[] {"a", "b"});
+                }
+                writer.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<int[]>())
+            {
+                Assert.Throws<ArgumentException>(() => logicalReader.ReadBatchSpaced<int>(new int[2], new ulong[1]));
+            }
+
+            using (var logicalReader = rowGroupReader.Column(1).LogicalReader<DateTime?>())
+            {
+                Assert.Throws<InvalidOperationException>(() => logicalReader.ReadBatchSpaced<DateTime>(new DateTime[2], new ulong[1]));
+            }
+
+            // Byte array values would point into page buffers released by reads that span pages
+            using (var columnReader = (ColumnReader<ByteArray>) rowGroupReader.Column(2))
+            {
+                Assert.Throws<NotSupportedException>(() => columnReader.ReadBatchSpaced(2, new ByteArray[2], new ulong[1], out _));
+            }
+        }
+
+        [TestCase(7)]
+        [TestCase(4096)]
+        public static void TestReadLists(int bufferLength)
+        {
+            const int numRows = 5_000;
+            var nullableValues = Enumerable.Range(0, numRows).Select(i =>
+                i % 10 == 0 ? null :
+                i % 10 == 1 ? new double?[0] :
+                Enumerable.Range(0, i % 5 + 1).Select(j => (i + j) % 7 == 0 ? null : (double?) (i + j * 0.5)).ToArray()).ToArray();
+            var values = Enumerable.Range(0, numRows).Select(i => i % 13 == 0 ? null : Enumerable.Range(i, i % 4).ToArray()).ToArray();
+            var timestamps = Enumerable.Range(0, numRows).Select(i => new[] {new DateTime(2024, 1, 1).AddSeconds(i)}).ToArray();
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                var columns = new Column[] {new Column<double?[]>("nullable_values"), new Column<int[]>("values"), new Column<DateTime[]>("timestamps")};
+                using var builder = new WriterPropertiesBuilder();
+                using var writerProperties = builder.DataPagesize(1024).Build();
+                using var writer = new ParquetFileWriter(outStream, columns, writerProperties);
+                using var rowGroupWriter = writer.AppendRowGroup();
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<double?[]>())
+                {
+                    colWriter.WriteBatch(nullableValues!);
+                }
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<int[]>())
+                {
+                    colWriter.WriteBatch(values!);
+                }
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<DateTime[]>())
+                {
+                    colWriter.WriteBatch(timestamps);
+                }
+                writer.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<double?[]?>(bufferLength))
+            {
+                Assert.AreEqual(nullableValues, logicalReader.ReadAll(numRows));
+                Assert.IsFalse(logicalReader.HasNext);
+            }
+
+            using (var logicalReader = rowGroupReader.Column(1).LogicalReader<int[]?>(bufferLength))
+            {
+                Assert.AreEqual(values.Take(1_000).ToArray(), logicalReader.ReadAll(1_000));
+                Assert.AreEqual(1_234, logicalReader.Skip(1_234));
+                Assert.AreEqual(values.Skip(2_234).ToArray(), logicalReader.ReadAll(numRows - 2_234));
+                Assert.IsFalse(logicalReader.HasNext);
+            }
+
+            using (var logicalReader = rowGroupReader.Column(2).LogicalReader<DateTime[]?>(bufferLength))
+            {
+                Assert.AreEqual(timestamps, logicalReader.ToArray());
+            }
+        }
+
+        [TestCase(7)]
+        [TestCase(4096)]
+        public static void TestReadBatchLists(int bufferLength)
+        {
+            const int numRows = 5_000;
+            var values = Enumerable.Range(0, numRows).Select(i => i % 13 == 0 ? null : Enumerable.Range(i, i % 6).ToArray()).ToArray();
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var writer = new ParquetFileWriter(outStream, new Column[] {new Column<int[]>("values"), new Column<string[]>("strings")});
+                using var rowGroupWriter = writer.AppendRowGroup();
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<int[]>())
+                {
+                    colWriter.WriteBatch(values!);
+                }
+                using (var colWriter = rowGroupWriter.NextColumn().LogicalWriter<string[]>())
+                {
+                    colWriter.WriteBatch(values.Select(v => v?.Select(x => x.ToString()).ToArray()).ToArray()!);
+                }
+                writer.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<int[]?>(bufferLength))
+            {
+                Assert.IsTrue(logicalReader.CanReadLists);
+
+                var offsets = new int[101];
+                var items = new int[150];
+                var validity = new ulong[2];
+                var read = new List<int[]?>();
+
+                Assert.AreEqual(10, logicalReader.ReadBatch(new int[]?[10]));
+                read.AddRange(values.Take(10));
+
+                while (logicalReader.HasNext)
+                {
+                    var rowsRead = logicalReader.ReadBatchLists<int>(offsets, items, validity, out var itemsRead);
+                    Assert.That(rowsRead, Is.GreaterThan(0));
+                    Assert.AreEqual(itemsRead, offsets[rowsRead]);
+                    for (var i = 0; i != rowsRead; ++i)
+                    {
+                        var isValid = (validity[i / 64] & (1UL << (i % 64))) != 0;
+                        read.Add(isValid ? items.AsSpan(offsets[i], offsets[i + 1] - offsets[i]).ToArray() : null);
+                    }
+                }
+
+                Assert.AreEqual(values, read.ToArray());
+                Assert.AreEqual(0, logicalReader.ReadBatchLists<int>(offsets, items, validity, out var finalItemsRead));
+                Assert.AreEqual(0, finalItemsRead);
+            }
+
+            using (var logicalReader = rowGroupReader.Column(0).LogicalReader<int[]?>(bufferLength))
+            {
+                // The second row has one item
+                Assert.AreEqual(1, logicalReader.Skip(1));
+                Assert.Throws<ArgumentException>(() => logicalReader.ReadBatchLists<int>(new int[2], Span<int>.Empty, new ulong[1], out _));
+                Assert.AreEqual(values.Skip(1).Take(3).ToArray(), logicalReader.ReadAll(3));
+            }
+
+            using (var logicalReader = rowGroupReader.Column(1).LogicalReader<string[]?>(bufferLength))
+            {
+                Assert.IsFalse(logicalReader.CanReadLists);
+                Assert.Throws<InvalidOperationException>(() => logicalReader.ReadBatchLists<string>(new int[2], new string[10], new ulong[1], out _));
+            }
+        }
+
+        [Test]
+        public static void TestReadListsReadsColumnChunkOnce()
+        {
+            const int numRows = 10_000;
+            var values = Enumerable.Range(0, numRows).Select(i => Enumerable.Range(i, i % 4).ToArray()).ToArray();
+
+            byte[] bytes;
+            using (var buffer = new MemoryStream())
+            {
+                using (var writer = new ParquetFileWriter(buffer, new Column[] {new Column<int[]>("values")}, leaveOpen: true))
+                {
+                    using var rowGroupWriter = writer.AppendRowGroup();
+                    using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<int[]>();
+                    colWriter.WriteBatch(values);
+                    writer.Close();
+                }
+                bytes = buffer.ToArray();
+            }
+
+            long bytesRead = 0;
+            using var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: (position, destination) =>
+            {
+                var length = Math.Max(0, Math.Min(destination.Length, bytes.Length - (int) position));
+                bytes.AsSpan((int) position, length).CopyTo(destination);
+                Interlocked.Add(ref bytesRead, length);
+                return length;
+            });
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var columnChunkMetaData = rowGroupReader.MetaData.GetColumnChunkMetaData(0);
+            var chunkSize = columnChunkMetaData.TotalCompressedSize;
+
+            var bytesReadBefore = Interlocked.Read(ref bytesRead);
+            using (var columnReader = rowGroupReader.Column(0))
+            using (var logicalReader = columnReader.LogicalReader<int[]>())
+            {
+                Assert.IsTrue(logicalReader.CanReadLists);
+                Assert.AreEqual(values, logicalReader.ReadAll(numRows));
+            }
+            Assert.That(Interlocked.Read(ref bytesRead) - bytesReadBefore, Is.InRange(chunkSize, 2 * chunkSize - 1));
+
+            // Once the column reader has created its native reader, lists are read through it
+            using (var columnReader = rowGroupReader.Column(0))
+            {
+                Assert.IsTrue(columnReader.HasNext);
+                using var logicalReader = columnReader.LogicalReader<int[]>();
+                Assert.IsFalse(logicalReader.CanReadLists);
+                Assert.AreEqual(values, logicalReader.ReadAll(numRows));
+            }
+        }
+
         [TestCaseSource(nameof(TestCases))]
         public static void TestSkip(TestCase testCase)
         {
@@ -78,6 +421,28 @@ namespace ParquetSharp.Test
             testCase.VerifyRead(logicalColumnReader, 75, 25);
         }
 
+        private static ResizableBuffer WriteStrings(string?[] values, bool disableDictionary)
+        {
+            using var builder = new WriterPropertiesBuilder();
+            builder.DataPagesize(1024);
+            if (disableDictionary)
+            {
+                builder.DisableDictionary();
+            }
+            using var writerProperties = builder.Build();
+
+            var buffer = new ResizableBuffer();
+            using var outStream = new BufferOutputStream(buffer);
+            using var writer = new ParquetFileWriter(outStream, new Column[] {new Column<string?>("venue")}, writerProperties);
+            using var rowGroupWriter = writer.AppendRowGroup();
+            using var colWriter = rowGroupWriter.NextColumn().LogicalWriter<string?>();
+
+            colWriter.WriteBatch(values);
+            writer.Close();
+
+            return buffer;
+        }
+
         public abstract class TestCase
         {
             protected TestCase(string name, Column definition)
@@ -1,6 +1,8 @@
 ﻿using System;
 using System.IO;
 using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
 using NUnit.Framework;
 using ParquetSharp.IO;
 
@@ -68,6 +70,144 @@ namespace ParquetSharp.Test
             }
         }
 
+        [Test]
+        public static void TestPositionalReader()
+        {
+            const int numColumns = 8;
+            var expected = Enumerable.Range(0, 100_000).ToArray();
+            var bytes = WriteColumns(numColumns, expected);
+            var numPositionalReads = 0;
+
+            int ReadAt(long position, Span<byte> buffer)
+            {
+                Interlocked.Increment(ref numPositionalReads);
+                var length = (int) Math.Max(0, Math.Min(buffer.Length, bytes.Length - position));
+                bytes.AsSpan((int) position, length).CopyTo(buffer);
+                return length;
+            }
+
+            using var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, ReadAt);
+            using var reader = new ParquetFileReader(input);
+            using var groupReader = reader.RowGroup(0);
+
+            // Column chunks are read concurrently, so each thread needs its own column reader
+            var columns = new int[numColumns][];
+            Parallel.For(0, numColumns, c =>
+            {
+                using var columnReader = groupReader.Column(c).LogicalReader<int>();
+                columns[c] = columnReader.ReadAll(expected.Length);
+            });
+
+            for (var c = 0; c != numColumns; ++c)
+            {
+                Assert.AreEqual(expected.Select(v => v + c).ToArray(), columns[c]);
+            }
+            Assert.That(numPositionalReads, Is.GreaterThanOrEqualTo(numColumns));
+        }
+
+        [Test]
+        public static void TestAsyncPositionalReader()
+        {
+            const int numColumns = 8;
+            var expected = Enumerable.Range(0, 100_000).ToArray();
+            var bytes = WriteColumns(numColumns, expected);
+            var numAsyncReads = 0;
+
+            async Task<int> ReadAtAsync(long position, Memory<byte> buffer)
+            {
+                Interlocked.Increment(ref numAsyncReads);
+                await Task.Delay(1);
+                var length = (int) Math.Max(0, Math.Min(buffer.Length, bytes.Length - position));
+                bytes.AsMemory((int) position, length).CopyTo(buffer);
+                return length;
+            }
+
+            using var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: null, ReadAtAsync);
+            using var reader = new ParquetFileReader(input);
+
+            // Pre-buffering reads column chunks asynchronously
+            var rowGroups = new[] {0};
+            var columns = Enumerable.Range(0, numColumns).ToArray();
+            reader.PreBuffer(rowGroups, columns, new CacheOptions(hole_size_limit: 0, range_size_limit: 1, lazy: false));
+            reader.WaitForBuffered(rowGroups, columns);
+            Assert.That(numAsyncReads, Is.GreaterThanOrEqualTo(numColumns));
+
+            using var groupReader = reader.RowGroup(0);
+            for (var c = 0; c != numColumns; ++c)
+            {
+                using var columnReader = groupReader.Column(c).LogicalReader<int>();
+                Assert.AreEqual(expected.Select(v => v + c).ToArray(), columnReader.ReadAll(expected.Length));
+            }
+        }
+
+        [Test]
+        public static void TestAsyncPositionalReaderException()
+        {
+            var bytes = WriteColumns(1, new[] {1, 2, 3});
+
+            static async Task<int> ReadAtAsync(long position, Memory<byte> buffer)
+            {
+                await Task.Yield();
+                throw new IOException("this is an erroneous reader");
+            }
+
+            using var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: null, ReadAtAsync);
+            using var reader = new ParquetFileReader(input);
+
+            reader.PreBuffer(new[] {0}, new[] {0});
+            var exception = Assert.Throws<ParquetException>(() => reader.WaitForBuffered(new[] {0}, new[] {0}));
+            Assert.That(exception?.Message, Does.Contain("this is an erroneous reader"));
+        }
+
+        [Test]
+        public static void TestWithAsyncReads()
+        {
+            const int numColumns = 4;
+            var expected = Enumerable.Range(0, 10_000).ToArray();
+
+            using var input = ManagedRandomAccessFile.WithAsyncReads(new MemoryStream(WriteColumns(numColumns, expected)));
+            using var reader = new ParquetFileReader(input);
+
+            var rowGroups = new[] {0};
+            var columns = Enumerable.Range(0, numColumns).ToArray();
+            reader.PreBuffer(rowGroups, columns, new CacheOptions(hole_size_limit: 0, range_size_limit: 1, lazy: false));
+
+            using var groupReader = reader.RowGroup(0);
+            for (var c = 0; c != numColumns; ++c)
+            {
+                using var columnReader = groupReader.Column(c).LogicalReader<int>();
+                Assert.AreEqual(expected.Select(v => v + c).ToArray(), columnReader.ReadAll(expected.Length));
+            }
+        }
+
+#if NET6_0_OR_GREATER
+        [Test]
+        public static void TestSafeFileHandle()
+        {
+            var expected = Enumerable.Range(0, 10_000).ToArray();
+            using var tempDir = new TempWorkingDirectory();
+            var path = Path.Combine(tempDir.DirectoryPath, "file.parquet");
+            File.WriteAllBytes(path, WriteColumns(2, expected));
+
+            using (var handle = File.OpenHandle(path))
+            {
+                using var input = new ManagedRandomAccessFile(handle, leaveOpen: true);
+                using var reader = new ParquetFileReader(input);
+                using var groupReader = reader.RowGroup(0);
+
+                for (var c = 0; c != 2; ++c)
+                {
+                    using var columnReader = groupReader.Column(c).LogicalReader<int>();
+                    Assert.AreEqual(expected.Select(v => v + c).ToArray(), columnReader.ReadAll(expected.Length));
+                }
+
+                Assert.IsFalse(handle.IsClosed);
+            }
+
+            File.Delete(path);
+        }
+#endif
+
         [Test]
         public static void TestWriteException()
         {
@@ -149,6 +289,59 @@ namespace ParquetSharp.Test
             Assert.AreEqual(expected, columnReader.ReadAll(expected.Length));
         }
 
+        [Test]
+        public static void TestBackgroundWrite([Values] bool useWriteAsync)
+        {
+            var expected = Enumerable.Range(0, 1024 * 1024).ToArray();
+            using var buffer = new SlowWriteStream();
+
+            using (var output = new ManagedOutputStream(buffer, leaveOpen: true, bufferSize: 64 * 1024, maxBuffers: 4, useWriteAsync))
+            {
+                using var writer = new ParquetFileWriter(output, new Column[] { new Column<int>("ids") });
+                for (var i = 0; i < 2; ++i)
+                {
+                    using var groupWriter = writer.AppendRowGroup();
+                    using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                    columnWriter.WriteBatch(expected);
+                }
+
+                writer.Close();
+            }
+
+            Assert.AreEqual(1, buffer.MaxConcurrentWrites);
+
+            using var input = new ManagedRandomAccessFile(new MemoryStream(buffer.ToArray()));
+            using var reader = new ParquetFileReader(input);
+            Assert.AreEqual(2, reader.FileMetaData.NumRowGroups);
+            for (var i = 0; i < 2; ++i)
+            {
+                using var groupReader = reader.RowGroup(i);
+                using var columnReader = groupReader.Column(0).LogicalReader<int>();
+                Assert.AreEqual(expected, columnReader.ReadAll(expected.Length));
+            }
+        }
+
+        [Test]
+        public static void TestBackgroundWriteException()
+        {
+            var exception = Assert.Throws<ParquetException>(() =>
+            {
+                using var buffer = new ErroneousWriterStream();
+                using var output = new ManagedOutputStream(buffer, leaveOpen: false, bufferSize: 64 * 1024, maxBuffers: 2);
+                using var writer = new ParquetFileWriter(output, new Column[] { new Column<int>("ids") });
+                using (var groupWriter = writer.AppendRowGroup())
+                {
+                    using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                    columnWriter.WriteBatch(Enumerable.Range(0, 1024 * 1024).ToArray());
+                }
+                writer.Close();
+            });
+
+            Assert.That(
+                exception?.Message,
+                Contains.Substring("this is an erroneous writer"));
+        }
+
         /// <summary>
         /// Test that when we don't keep a handle to an OutputStream via a using
         /// statement, we can still successfully write a file.
@@ -243,6 +436,23 @@ namespace ParquetSharp.Test
             return new ParquetFileWriter(stream, new Column[] { new Column<int>("ids") });
         }
 
+        private static byte[] WriteColumns(int numColumns, int[] values)
+        {
+            using var buffer = new MemoryStream();
+            using (var output = new ManagedOutputStream(buffer, leaveOpen: true))
+            {
+                using var writer = new ParquetFileWriter(output, Enumerable.Range(0, numColumns).Select(c => (Column) new Column<int>($"col_{c}")).ToArray());
+                using var groupWriter = writer.AppendRowGroup();
+                for (var c = 0; c != numColumns; ++c)
+                {
+                    using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                    columnWriter.WriteBatch(values.Select(v => v + c).ToArray());
+                }
+                writer.Close();
+            }
+            return buffer.ToArray();
+        }
+
         private static ParquetFileReader GetReaderWithDroppedFile(MemoryStream buffer)
         {
             var file = new ManagedRandomAccessFile(buffer);
@@ -265,6 +475,46 @@ namespace ParquetSharp.Test
             }
         }
 
+        /// <summary>
+        /// Simulate a slow, non-seekable destination such as a network upload,
+        /// recording the maximum number of writes that were in progress at once.
+        /// </summary>
+        private sealed class SlowWriteStream : MemoryStream
+        {
+            public override bool CanSeek => false;
+
+            public int MaxConcurrentWrites { get; private set; }
+
+            public override void Write(byte[] buffer, int offset, int count)
+            {
+                BeginWrite();
+                Thread.Sleep(1);
+                base.Write(buffer, offset, count);
+                EndWrite();
+            }
+
+            public override async Task WriteAsync(byte[] buffer, int offset, int count, CancellationToken cancellationToken)
+            {
+                BeginWrite();
+                await Task.Delay(1, cancellationToken);
+                base.Write(buffer, offset, count);
+                EndWrite();
+            }
+
+            private void BeginWrite()
+            {
+                var writes = Interlocked.Increment(ref _writes);
+                MaxConcurrentWrites = Math.Max(MaxConcurrentWrites, writes);
+            }
+
+            private void EndWrite()
+            {
+                Interlocked.Decrement(ref _writes);
+            }
+
+            private int _writes;
+        }
+
         /// <summary>
         /// Simulate a stream that only partially fulfills reads sometimes,
         /// eg. for data streamed from a cloud service (see https://github.com/G-Research/ParquetSharp/issues/263)
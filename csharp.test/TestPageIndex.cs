@@ -0,0 +1,122 @@
+using System.Linq;
+using NUnit.Framework;
+using ParquetSharp.IO;
+
+namespace ParquetSharp.Test
+{
+    [TestFixture]
+    internal static class TestPageIndex
+    {
+        [Test]
+        public static void TestReadColumnAndOffsetIndex()
+        {
+            const int numRows = 10_000;
+            var values = Enumerable.Range(0, numRows).Select(i => (long) i).ToArray();
+            var nullableValues = Enumerable.Range(0, numRows).Select(i => i < numRows / 2 ? (double?) null : i).ToArray();
+
+            using var buffer = WriteFile(values, nullableValues, writePageIndex: true);
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var pageIndexReader = fileReader.GetPageIndexReader();
+
+            Assert.IsNotNull(pageIndexReader);
+
+            using var rowGroupPageIndex = pageIndexReader!.RowGroup(0);
+
+            Assert.IsNotNull(rowGroupPageIndex);
+
+            using var offsetIndex = rowGroupPageIndex!.GetOffsetIndex(0);
+            using var columnIndex = rowGroupPageIndex.GetColumnIndex(0);
+
+            Assert.IsNotNull(offsetIndex);
+            Assert.IsInstanceOf<ColumnIndex<long>>(columnIndex);
+
+            var pageLocations = offsetIndex!.PageLocations;
+            var longColumnIndex = (ColumnIndex<long>) columnIndex!;
+            var mins = longColumnIndex.MinValues;
+            var maxes = longColumnIndex.MaxValues;
+
+            Assert.That(pageLocations.Length, Is.GreaterThan(1));
+            Assert.AreEqual(pageLocations.Length, longColumnIndex.NumPages);
+            Assert.AreEqual(BoundaryOrder.Ascending, longColumnIndex.BoundaryOrder);
+            Assert.AreEqual(0, pageLocations[0].FirstRowIndex);
+            Assert.IsTrue(longColumnIndex.NullPages.All(nullPage => !nullPage));
+
+            for (var page = 0; page < pageLocations.Length; ++page)
+            {
+                var firstRow = pageLocations[page].FirstRowIndex;
+                var lastRow = page + 1 < pageLocations.Length ? pageLocations[page + 1].FirstRowIndex - 1 : numRows - 1;
+
+                Assert.That(pageLocations[page].CompressedPageSize, Is.GreaterThan(0));
+                Assert.AreEqual(values[firstRow], mins[page]);
+                Assert.AreEqual(values[lastRow], maxes[page]);
+
+                if (page > 0)
+                {
+                    Assert.That(pageLocations[page].Offset, Is.GreaterThan(pageLocations[page - 1].Offset));
+                }
+            }
+
+            using var nullableColumnIndex = rowGroupPageIndex.GetColumnIndex(1);
+            using var nullableOffsetIndex = rowGroupPageIndex.GetOffsetIndex(1);
+
+            Assert.IsInstanceOf<ColumnIndex<double>>(nullableColumnIndex);
+            Assert.IsTrue(nullableColumnIndex!.HasNullCounts);
+            Assert.AreEqual(numRows / 2, nullableColumnIndex.NullCounts.Sum());
+            Assert.IsTrue(nullableColumnIndex.NullPages[0]);
+            Assert.IsFalse(nullableColumnIndex.NullPages[nullableColumnIndex.NumPages - 1]);
+            Assert.AreEqual(nullableColumnIndex.NumPages, nullableOffsetIndex!.PageLocations.Length);
+        }
+
+        [Test]
+        public static void TestNoPageIndex()
+        {
+            var values = Enumerable.Range(0, 100).Select(i => (long) i).ToArray();
+            var nullableValues = values.Select(v => (double?) v).ToArray();
+
+            using var buffer = WriteFile(values, nullableValues, writePageIndex: false);
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var pageIndexReader = fileReader.GetPageIndexReader();
+            using var rowGroupPageIndex = pageIndexReader?.RowGroup(0);
+
+            Assert.IsNull(rowGroupPageIndex?.GetColumnIndex(0));
+            Assert.IsNull(rowGroupPageIndex?.GetOffsetIndex(0));
+        }
+
+        private static ResizableBuffer WriteFile(long[] values, double?[] nullableValues, bool writePageIndex)
+        {
+            var columns = new Column[]
+            {
+                new Column<long>("id"),
+                new Column<double?>("value"),
+            };
+
+            using var builder = new WriterPropertiesBuilder();
+            builder.DataPagesize(1024).WriteBatchSize(128);
+            if (writePageIndex)
+            {
+                builder.EnableWritePageIndex();
+            }
+            using var writerProperties = builder.Build();
+
+            var buffer = new ResizableBuffer();
+            using var output = new BufferOutputStream(buffer);
+            using var fileWriter = new ParquetFileWriter(output, columns, writerProperties);
+            using var rowGroupWriter = fileWriter.AppendRowGroup();
+
+            using (var idWriter = rowGroupWriter.NextColumn().LogicalWriter<long>())
+            {
+                idWriter.WriteBatch(values);
+            }
+
+            using (var valueWriter = rowGroupWriter.NextColumn().LogicalWriter<double?>())
+            {
+                valueWriter.WriteBatch(nullableValues);
+            }
+
+            fileWriter.Close();
+            return buffer;
+        }
+    }
+}
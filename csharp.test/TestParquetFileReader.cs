@@ -2,6 +2,7 @@ using System;
 using System.IO;
 using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading;
 using NUnit.Framework;
 using ParquetSharp.IO;
 
@@ -59,6 +60,274 @@ namespace ParquetSharp.Test
             Assert.That(exception?.Message, Does.StartWith("Tried to get a LogicalColumnReader"));
         }
 
+        [Test]
+        public static void TestMemoryMappedFile()
+        {
+            using var tempDir = new TempWorkingDirectory();
+            var path = Path.Combine(tempDir.DirectoryPath, "file.parquet");
+            var values = Enumerable.Range(0, 10_000).ToArray();
+
+            using (var writer = new ParquetFileWriter(path, new Column[] {new Column<int>("ids")}))
+            {
+                using var groupWriter = writer.AppendRowGroup();
+                using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                columnWriter.WriteBatch(values);
+                writer.Close();
+            }
+
+            using (var reader = new ParquetFileReader(path, readerProperties: null, memoryMap: true))
+            {
+                using var groupReader = reader.RowGroup(0);
+                using var columnReader = groupReader.Column(0).LogicalReader<int>();
+
+                Assert.AreEqual(values, columnReader.ReadAll(values.Length));
+            }
+
+            // The mapping is released when the reader is disposed, so the file can be deleted
+            File.Delete(path);
+        }
+
+        [Test]
+        public static void TestPreBuffer()
+        {
+            const int numColumns = 20;
+            var columnIndices = new[] {2, 3, 5, 7, 11};
+            var values = Enumerable.Range(0, 1_000).ToArray();
+
+            using var buffer = new MemoryStream();
+            using (var writer = new ParquetFileWriter(buffer, Enumerable.Range(0, numColumns).Select(c => (Column) new Column<int>($"col_{c}")).ToArray(), leaveOpen: true))
+            {
+                for (var rowGroup = 0; rowGroup != 2; ++rowGroup)
+                {
+                    using var groupWriter = writer.AppendRowGroup();
+                    for (var c = 0; c != numColumns; ++c)
+                    {
+                        using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                        columnWriter.WriteBatch(values.Select(v => v * c + rowGroup).ToArray());
+                    }
+                }
+                writer.Close();
+            }
+
+            int ReadColumns(bool preBuffer)
+            {
+                using var stream = new ReadCountingStream(buffer.ToArray());
+                using var reader = new ParquetFileReader(stream, leaveOpen: true);
+                var rowGroups = new[] {0, 1};
+
+                if (preBuffer)
+                {
+                    reader.PreBuffer(rowGroups, columnIndices);
+                    reader.WaitForBuffered(rowGroups, columnIndices);
+                }
+
+                foreach (var rowGroup in rowGroups)
+                {
+                    using var groupReader = reader.RowGroup(rowGroup);
+                    foreach (var c in columnIndices)
+                    {
+                        using var columnReader = groupReader.Column(c).LogicalReader<int>();
+                        Assert.AreEqual(values.Select(v => v * c + rowGroup).ToArray(), columnReader.ReadAll(values.Length));
+                    }
+                }
+
+                return stream.ReadCount;
+            }
+
+            // Pre-buffering coalesces the column chunks of each row group into a single read
+            Assert.That(ReadColumns(preBuffer: true), Is.LessThan(ReadColumns(preBuffer: false)));
+        }
+
+        [TestCase(0L)]
+        [TestCase(10_000L)]
+        [TestCase(long.MaxValue)]
+        public static void TestReadRowGroupsWithReadAhead(long readAheadBytes)
+        {
+            const int numColumns = 10;
+            const int numRowGroups = 6;
+            var columnIndices = new[] {1, 4, 8};
+            var values = Enumerable.Range(0, 1_000).ToArray();
+
+            using var buffer = new MemoryStream();
+            using (var writer = new ParquetFileWriter(buffer, Enumerable.Range(0, numColumns).Select(c => (Column) new Column<int>($"col_{c}")).ToArray(), leaveOpen: true))
+            {
+                for (var rowGroup = 0; rowGroup != numRowGroups; ++rowGroup)
+                {
+                    using var groupWriter = writer.AppendRowGroup();
+                    for (var c = 0; c != numColumns; ++c)
+                    {
+                        using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                        columnWriter.WriteBatch(values.Select(v => v * c + rowGroup).ToArray());
+                    }
+                }
+                writer.Close();
+            }
+
+            using var stream = new ReadCountingStream(buffer.ToArray());
+            using var reader = new ParquetFileReader(stream, leaveOpen: true);
+            var rowGroups = new[] {5, 0, 1, 2, 4};
+
+            var rowGroupIndex = 0;
+            foreach (var groupReader in reader.ReadRowGroupsWithReadAhead(columnIndices, readAheadBytes, rowGroups))
+            {
+                var rowGroup = rowGroups[rowGroupIndex++];
+                foreach (var c in columnIndices)
+                {
+                    using var columnReader = groupReader.Column(c).LogicalReader<int>();
+                    Assert.AreEqual(values.Select(v => v * c + rowGroup).ToArray(), columnReader.ReadAll(values.Length));
+                }
+            }
+
+            Assert.AreEqual(rowGroups.Length, rowGroupIndex);
+
+            // Stopping early disposes any row groups that were fetched ahead
+            Assert.AreEqual(1, reader.ReadRowGroupsWithReadAhead(columnIndices, readAheadBytes).Take(1).Count());
+        }
+
+        [Test]
+        public static void TestReadRowGroupsWithReadAheadOfOneRowGroup()
+        {
+            const int numRowGroups = 4;
+            var columnIndices = new[] {0};
+
+            using var buffer = new MemoryStream();
+            using (var writer = new ParquetFileWriter(buffer, new Column[] {new Column<int>("ids")}, leaveOpen: true))
+            {
+                for (var rowGroup = 0; rowGroup != numRowGroups; ++rowGroup)
+                {
+                    using var groupWriter = writer.AppendRowGroup();
+                    using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                    columnWriter.WriteBatch(Enumerable.Range(rowGroup * 1_000, 1_000).ToArray());
+                }
+                writer.Close();
+            }
+
+            buffer.Position = 0;
+            using var reader = new ParquetFileReader(buffer, leaveOpen: true);
+            var maxRowGroupBytes = Enumerable.Range(0, numRowGroups).Max(rowGroup =>
+            {
+                using var groupReader = reader.RowGroup(rowGroup);
+                using var columnChunkMetaData = groupReader.MetaData.GetColumnChunkMetaData(0);
+                return columnChunkMetaData.TotalCompressedSize;
+            });
+
+            // The current row group doesn't count towards the budget, so the next row group is fetched before the current one is read
+            var rowGroupIndex = 0;
+            foreach (var groupReader in reader.ReadRowGroupsWithReadAhead(columnIndices, maxRowGroupBytes))
+            {
+                if (rowGroupIndex + 1 < numRowGroups)
+                {
+                    Assert.DoesNotThrow(() => reader.WaitForBuffered(new[] {rowGroupIndex + 1}, columnIndices));
+                }
+
+                using var columnReader = groupReader.Column(0).LogicalReader<int>();
+                Assert.AreEqual(Enumerable.Range(rowGroupIndex * 1_000, 1_000).ToArray(), columnReader.ReadAll(1_000));
+                ++rowGroupIndex;
+            }
+
+            Assert.AreEqual(numRowGroups, rowGroupIndex);
+        }
+
+        [Test]
+        public static void TestWaitForBufferedWithoutPreBuffer()
+        {
+            using var buffer = new MemoryStream();
+            using (var writer = new ParquetFileWriter(buffer, new Column[] {new Column<int>("ids")}, leaveOpen: true))
+            {
+                using var groupWriter = writer.AppendRowGroup();
+                using var columnWriter = groupWriter.NextColumn().LogicalWriter<int>();
+                columnWriter.WriteBatch(new[] {1, 2, 3});
+                writer.Close();
+            }
+
+            buffer.Position = 0;
+            using var reader = new ParquetFileReader(buffer, leaveOpen: true);
+
+            Assert.Throws<ParquetException>(() => reader.WaitForBuffered(new[] {0}, new[] {0}));
+        }
+
+        [Test]
+        public static void TestForEachRowGroup()
+        {
+            const int numRowGroups = 12;
+            var bytes = WriteRowGroups(numRowGroups, rowsPerGroup: 1_000);
+
+            using var reader = new ParquetFileReader(new MemoryStream(bytes));
+            var sums = new long[numRowGroups];
+
+            reader.ForEachRowGroup((rowGroup, rowGroupReader) =>
+            {
+                using var columnReader = rowGroupReader.Column(0).LogicalReader<long>();
+                sums[rowGroup] = columnReader.ReadAll((int) rowGroupReader.MetaData.NumRows).Sum();
+            }, maxDegreeOfParallelism: 4);
+
+            Assert.AreEqual(Enumerable.Range(0, numRowGroups).Select(ExpectedSum).ToArray(), sums);
+
+            var visited = new int[numRowGroups];
+            reader.ForEachRowGroup((rowGroup, _) => Interlocked.Increment(ref visited[rowGroup]), rowGroups: new[] {1, 5, 7});
+            Assert.AreEqual(Enumerable.Range(0, numRowGroups).Select(r => r is 1 or 5 or 7 ? 1 : 0).ToArray(), visited);
+
+            var exception = Assert.Throws<AggregateException>(() => reader.ForEachRowGroup((rowGroup, _) =>
+            {
+                if (rowGroup == 3) throw new InvalidOperationException("failed");
+            }));
+            Assert.IsInstanceOf<InvalidOperationException>(exception!.InnerExceptions.Single());
+        }
+
+        [Test]
+        public static void TestScanRowGroups()
+        {
+            const int numRowGroups = 12;
+            var bytes = WriteRowGroups(numRowGroups, rowsPerGroup: 1_000);
+
+            using var stream = new MemoryStream(bytes);
+            using var input = new ManagedRandomAccessFile(stream, leaveOpen: true, readAt: (position, destination) =>
+            {
+                var length = Math.Max(0, Math.Min(destination.Length, bytes.Length - (int) position));
+                bytes.AsSpan((int) position, length).CopyTo(destination);
+                return length;
+            });
+            using var reader = new ParquetFileReader(input);
+
+            var sums = reader.ScanRowGroups((rowGroup, rowGroupReader) =>
+            {
+                using var columnReader = rowGroupReader.Column(0).LogicalReader<long>();
+                return (rowGroup, sum: columnReader.ReadAll((int) rowGroupReader.MetaData.NumRows).Sum());
+            }, maxDegreeOfParallelism: 3).ToArray();
+
+            Assert.AreEqual(Enumerable.Range(0, numRowGroups).Select(r => (r, ExpectedSum(r))).ToArray(), sums);
+
+            // Results are returned in the requested order, and enumeration can stop early
+            var rowGroups = new[] {9, 2, 4, 0};
+            Assert.AreEqual(rowGroups, reader.ScanRowGroups((rowGroup, _) => rowGroup, rowGroups: rowGroups).ToArray());
+            Assert.AreEqual(new[] {9, 2}, reader.ScanRowGroups((rowGroup, _) => rowGroup, rowGroups: rowGroups).Take(2).ToArray());
+
+            Assert.Throws<ArgumentOutOfRangeException>(() => reader.ScanRowGroups((rowGroup, _) => rowGroup, rowGroups: new[] {numRowGroups}));
+        }
+
+        private static byte[] WriteRowGroups(int numRowGroups, int rowsPerGroup)
+        {
+            using var buffer = new MemoryStream();
+            using (var writer = new ParquetFileWriter(buffer, new Column[] {new Column<long>("values")}, leaveOpen: true))
+            {
+                for (var rowGroup = 0; rowGroup != numRowGroups; ++rowGroup)
+                {
+                    using var groupWriter = writer.AppendRowGroup();
+                    using var columnWriter = groupWriter.NextColumn().LogicalWriter<long>();
+                    columnWriter.WriteBatch(Enumerable.Range(0, rowsPerGroup).Select(i => (long) rowGroup * rowsPerGroup + i).ToArray());
+                }
+                writer.Close();
+            }
+
+            return buffer.ToArray();
+        }
+
+        private static long ExpectedSum(int rowGroup)
+        {
+            const long rowsPerGroup = 1_000;
+            return Enumerable.Range(0, (int) rowsPerGroup).Sum(i => rowGroup * rowsPerGroup + i);
+        }
+
         /// <summary>
         /// Test that finalizers work correctly and do not crash when we forget to dispose the ParquetFileReader 
         /// </summary>
@@ -192,5 +461,22 @@ namespace ParquetSharp.Test
 
             return value.ToString();
         }
+
+        private sealed class ReadCountingStream : MemoryStream
+        {
+            public ReadCountingStream(byte[] buffer) : base(buffer)
+            {
+            }
+
+            public int ReadCount => _readCount;
+
+            public override int Read(byte[] buffer, int offset, int count)
+            {
+                Interlocked.Increment(ref _readCount);
+                return base.Read(buffer, offset, count);
+            }
+
+            private int _readCount;
+        }
     }
 }
@@ -323,6 +323,148 @@ namespace ParquetSharp.Test
             Assert.AreEqual(strings, columnReader.ReadAll(numStrings));
         }
 
+        [Test]
+        public static void TestParallelRowGroup()
+        {
+            const int numColumns = 30;
+            const int numRowGroups = 3;
+            const int numBatches = 5;
+            const int batchSize = 1_000;
+
+            object[] Batch(int column, int rowGroup, int batch)
+            {
+                var offset = (rowGroup * numBatches + batch) * batchSize;
+                var rows = Enumerable.Range(offset, batchSize);
+                return (column % 3) switch
+                {
+                    0 => rows.Select(i => (object) (i * column)).ToArray(),
+                    1 => rows.Select(i => (object) (i % 7 == 0 ? null : (double?) (i * 0.5 + column))).ToArray(),
+                    _ => rows.Select(i => (object) $"row {i} column {column}").ToArray(),
+                };
+            }
+
+            var columns = Enumerable.Range(0, numColumns).Select(c => (c % 3) switch
+            {
+                0 => (Column) new Column<int>($"c{c}"),
+                1 => new Column<double?>($"c{c}"),
+                _ => new Column<string>($"c{c}"),
+            }).ToArray();
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var builder = new WriterPropertiesBuilder();
+                using var writerProperties = builder.Compression(Compression.Snappy).Build();
+                using var fileWriter = new ParquetFileWriter(outStream, columns, writerProperties);
+
+                for (var rowGroup = 0; rowGroup != numRowGroups; ++rowGroup)
+                {
+                    using var rowGroupWriter = fileWriter.AppendParallelRowGroup(maxDegreeOfParallelism: 4);
+
+                    // Submit batches from multiple threads, with each column's batches submitted in order by one thread
+                    Parallel.For(0, numColumns, c =>
+                    {
+                        for (var batch = 0; batch != numBatches; ++batch)
+                        {
+                            var values = Batch(c, rowGroup, batch);
+                            _ = (c % 3) switch
+                            {
+                                0 => rowGroupWriter.WriteColumn(c, values.Cast<int>().ToArray()),
+                                1 => rowGroupWriter.WriteColumn(c, values.Cast<double?>().ToArray()),
+                                _ => rowGroupWriter.WriteColumn(c, values.Cast<string>().ToArray()),
+                            };
+                        }
+                    });
+
+                    rowGroupWriter.Close();
+                }
+
+                fileWriter.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            Assert.AreEqual(numRowGroups, fileReader.FileMetaData.NumRowGroups);
+
+            for (var rowGroup = 0; rowGroup != numRowGroups; ++rowGroup)
+            {
+                using var rowGroupReader = fileReader.RowGroup(rowGroup);
+                for (var c = 0; c != numColumns; ++c)
+                {
+                    using var columnReader = rowGroupReader.Column(c).LogicalReader();
+                    var expected = Enumerable.Range(0, numBatches).SelectMany(batch => Batch(c, rowGroup, batch)).ToArray();
+                    var actual = columnReader.Apply(new LogicalValueGetter(numBatches * batchSize));
+                    Assert.AreEqual(expected, actual);
+                }
+            }
+        }
+
+        [Test]
+        public static void TestParallelRowGroupWriteError()
+        {
+            using var buffer = new ResizableBuffer();
+            using var outStream = new BufferOutputStream(buffer);
+            using var fileWriter = new ParquetFileWriter(outStream, new Column[] {new Column<int>("a"), new Column<float>("b")});
+            using var rowGroupWriter = fileWriter.AppendParallelRowGroup();
+
+            Assert.DoesNotThrow(() => rowGroupWriter.WriteColumn(0, new[] {1, 2, 3}).Wait());
+            var failed = rowGroupWriter.WriteColumn(1, new[] {1, 2, 3});
+            var following = rowGroupWriter.WriteColumn(1, new[] {1.0f});
+
+            Assert.ThrowsAsync<InvalidCastException>(() => failed);
+            Assert.ThrowsAsync<InvalidCastException>(() => following);
+            Assert.Throws<AggregateException>(() => rowGroupWriter.Close());
+            Assert.Throws<InvalidOperationException>(() => rowGroupWriter.WriteColumn(0, new[] {4}));
+        }
+
+        [Test]
+        public static void TestGetBufferedRowGroup()
+        {
+            const int numBatches = 20;
+            const int batchSize = 1_000;
+            // Each batch has 12 kB of plain encoded values, so row groups are started after every 5 batches
+            const long maxRowGroupBytes = 50_000;
+
+            using var buffer = new ResizableBuffer();
+            using (var outStream = new BufferOutputStream(buffer))
+            {
+                using var builder = new WriterPropertiesBuilder();
+                using var writerProperties = builder.Compression(Compression.Uncompressed).DisableDictionary().Build();
+                using var fileWriter = new ParquetFileWriter(outStream, new Column[] {new Column<int>("a"), new Column<double>("b")}, writerProperties);
+
+                for (var batch = 0; batch != numBatches; ++batch)
+                {
+                    var rowGroupWriter = fileWriter.GetBufferedRowGroup(maxRowGroupBytes);
+                    var rows = Enumerable.Range(batch * batchSize, batchSize).ToArray();
+                    using (var columnWriter = rowGroupWriter.Column(0).LogicalWriter<int>())
+                    {
+                        columnWriter.WriteBatch(rows);
+                    }
+                    using (var columnWriter = rowGroupWriter.Column(1).LogicalWriter<double>())
+                    {
+                        columnWriter.WriteBatch(rows.Select(i => i * 0.5).ToArray());
+                    }
+                    Assert.That(rowGroupWriter.EstimatedCompressedBytes, Is.GreaterThan(0));
+                }
+
+                fileWriter.Close();
+            }
+
+            using var inStream = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(inStream);
+            Assert.AreEqual(4, fileReader.FileMetaData.NumRowGroups);
+
+            var values = new List<int>();
+            for (var rowGroup = 0; rowGroup != fileReader.FileMetaData.NumRowGroups; ++rowGroup)
+            {
+                using var rowGroupReader = fileReader.RowGroup(rowGroup);
+                Assert.AreEqual(5 * batchSize, rowGroupReader.MetaData.NumRows);
+                using var columnReader = rowGroupReader.Column(0).LogicalReader<int>();
+                values.AddRange(columnReader.ReadAll((int) rowGroupReader.MetaData.NumRows));
+            }
+            Assert.AreEqual(Enumerable.Range(0, numBatches * batchSize).ToArray(), values.ToArray());
+        }
+
         [Test]
         [Explicit("Stress test the parquet calls in multiple threads")]
         public static void TestReadWriteParquetMultipleTasks()
@@ -0,0 +1,217 @@
+using System;
+using System.Linq;
+using NUnit.Framework;
+using ParquetSharp.IO;
+
+namespace ParquetSharp.Test
+{
+    [TestFixture]
+    internal static class TestPredicate
+    {
+        [Test]
+        public static void TestRowGroupAndPageSelection()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            var selection = fileReader.SelectRows(Predicate.GreaterThanOrEqual("id", 8_500L));
+
+            Assert.AreEqual(NumRowGroups, selection.NumRowGroups);
+            Assert.AreEqual(new[] {8, 9}, selection.SelectedRowGroups.ToArray());
+            Assert.AreEqual(new[] {new RowRange(0, RowsPerRowGroup)}, selection.RowRanges(9).ToArray());
+            Assert.That(selection.NumRows, Is.LessThan(2 * RowsPerRowGroup));
+            AssertSelects(selection, id => id >= 8_500);
+        }
+
+        [Test]
+        public static void TestEquality()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            var selection = fileReader.SelectRows(Predicate.Equal("id", 4_321));
+
+            Assert.AreEqual(new[] {4}, selection.SelectedRowGroups.ToArray());
+            Assert.That(selection.NumRows, Is.LessThan(RowsPerRowGroup));
+            AssertSelects(selection, id => id == 4_321);
+
+            // Values outside the range of the physical type can never match
+            Assert.AreEqual(0, fileReader.SelectRows(Predicate.Equal("id", ulong.MaxValue)).NumRows);
+        }
+
+        [Test]
+        public static void TestAndOr()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            var or = fileReader.SelectRows(Predicate.Or(Predicate.Equal("id", 5L), Predicate.In("id", new[] {9_995L, 20_000L})));
+            Assert.AreEqual(new[] {0, 9}, or.SelectedRowGroups.ToArray());
+            AssertSelects(or, id => id == 5 || id == 9_995);
+
+            var and = fileReader.SelectRows(Predicate.And(Predicate.GreaterThan("id", 2_000L), Predicate.LessThan("id", 3_000L)));
+            Assert.AreEqual(new[] {2}, and.SelectedRowGroups.ToArray());
+            AssertSelects(and, id => id > 2_000 && id < 3_000);
+
+            var empty = fileReader.SelectRows(Predicate.And(Predicate.LessThan("id", 100L), Predicate.GreaterThan("id", 9_000L)));
+            Assert.AreEqual(0, empty.NumRows);
+        }
+
+        [Test]
+        public static void TestNulls()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            var isNull = fileReader.SelectRows(Predicate.IsNull("value"));
+            Assert.AreEqual(new[] {NullRowGroup}, isNull.SelectedRowGroups.ToArray());
+
+            var isNotNull = fileReader.SelectRows(Predicate.IsNotNull("value"));
+            Assert.AreEqual(Enumerable.Range(0, NumRowGroups).Where(i => i != NullRowGroup).ToArray(), isNotNull.SelectedRowGroups.ToArray());
+
+            // Comparisons never match nulls
+            var comparison = fileReader.SelectRows(Predicate.LessThan("value", double.MaxValue));
+            Assert.IsFalse(comparison.IsRowGroupSelected(NullRowGroup));
+        }
+
+        [Test]
+        public static void TestBloomFilter()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            var present = fileReader.SelectRows(Predicate.Equal("name", "name_1234"));
+            Assert.That(present.NumRows, Is.GreaterThan(0));
+            AssertSelects(present, id => id == 1_234);
+
+            // Within the min and max of several row groups and pages, but rejected by the bloom filters
+            var absent = fileReader.SelectRows(Predicate.Equal("name", "name_1234a"));
+            Assert.AreEqual(0, absent.NumRows);
+        }
+
+        [Test]
+        public static void TestUnsignedSortOrder()
+        {
+            var columns = new Column[] {new Column<uint>("u")};
+
+            using var buffer = new ResizableBuffer();
+            using (var output = new BufferOutputStream(buffer))
+            {
+                using var fileWriter = new ParquetFileWriter(output, columns);
+                using (var rowGroupWriter = fileWriter.AppendRowGroup())
+                {
+                    using var writer = rowGroupWriter.NextColumn().LogicalWriter<uint>();
+                    writer.WriteBatch(Enumerable.Range(0, 100).Select(i => (uint) i).ToArray());
+                }
+                using (var rowGroupWriter = fileWriter.AppendRowGroup())
+                {
+                    using var writer = rowGroupWriter.NextColumn().LogicalWriter<uint>();
+                    writer.WriteBatch(Enumerable.Range(0, 100).Select(i => uint.MaxValue - (uint) i).ToArray());
+                }
+                fileWriter.Close();
+            }
+
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            Assert.AreEqual(new[] {1}, fileReader.SelectRows(Predicate.GreaterThan("u", (uint) int.MaxValue)).SelectedRowGroups.ToArray());
+            Assert.AreEqual(new[] {0}, fileReader.SelectRows(Predicate.LessThan("u", 1_000)).SelectedRowGroups.ToArray());
+        }
+
+        [Test]
+        public static void TestInvalidPredicates()
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            Assert.Throws<ArgumentException>(() => fileReader.SelectRows(Predicate.Equal("not_a_column", 1)));
+            Assert.Throws<ArgumentException>(() => fileReader.SelectRows(Predicate.Equal("id", "1")));
+            Assert.Throws<ArgumentException>(() => fileReader.SelectRows(Predicate.Equal("name", 1.0)));
+        }
+
+        /// <summary>
+        /// Check that the selection covers all rows matching a predicate on the id, by reading the selected rows.
+        /// </summary>
+        private static void AssertSelects(RowSelection selection, Func<long, bool> predicate)
+        {
+            using var buffer = WriteFile();
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+
+            for (var rowGroup = 0; rowGroup != NumRowGroups; ++rowGroup)
+            {
+                var expected = Ids(rowGroup).Where(predicate).ToArray();
+                if (!selection.IsRowGroupSelected(rowGroup))
+                {
+                    Assert.IsEmpty(expected);
+                    continue;
+                }
+
+                using var rowGroupReader = fileReader.RowGroup(rowGroup);
+                using var columnReader = rowGroupReader.Column(0, selection);
+                using var logicalReader = columnReader.LogicalReader<long>();
+                var selectedIds = logicalReader.ReadAll((int) selection.RowRanges(rowGroup).Sum(r => r.Length));
+
+                Assert.That(expected.Except(selectedIds), Is.Empty);
+            }
+        }
+
+        private static ResizableBuffer WriteFile()
+        {
+            var columns = new Column[]
+            {
+                new Column<long>("id"),
+                new Column<string>("name"),
+                new Column<double?>("value"),
+            };
+
+            using var builder = new WriterPropertiesBuilder();
+            builder
+                .DataPagesize(1024)
+                .WriteBatchSize(128)
+                .EnableWritePageIndex()
+                .EnableBloomFilter("name", new BloomFilterOptions(RowsPerRowGroup, 0.001));
+            using var writerProperties = builder.Build();
+
+            var buffer = new ResizableBuffer();
+            using var output = new BufferOutputStream(buffer);
+            using var fileWriter = new ParquetFileWriter(output, columns, writerProperties);
+
+            for (var rowGroup = 0; rowGroup != NumRowGroups; ++rowGroup)
+            {
+                var ids = Ids(rowGroup);
+                using var rowGroupWriter = fileWriter.AppendRowGroup();
+
+                using (var idWriter = rowGroupWriter.NextColumn().LogicalWriter<long>())
+                {
+                    idWriter.WriteBatch(ids);
+                }
+
+                using (var nameWriter = rowGroupWriter.NextColumn().LogicalWriter<string>())
+                {
+                    nameWriter.WriteBatch(ids.Select(id => $"name_{id}").ToArray());
+                }
+
+                using (var valueWriter = rowGroupWriter.NextColumn().LogicalWriter<double?>())
+                {
+                    valueWriter.WriteBatch(ids.Select(id => rowGroup == NullRowGroup ? (double?) null : id * 0.5).ToArray());
+                }
+            }
+
+            fileWriter.Close();
+            return buffer;
+        }
+
+        private static long[] Ids(int rowGroup) => Enumerable.Range(rowGroup * RowsPerRowGroup, RowsPerRowGroup).Select(i => (long) i).ToArray();
+
+        private const int NumRowGroups = 10;
+        private const int RowsPerRowGroup = 1_000;
+        private const int NullRowGroup = 3;
+    }
+}
@@ -0,0 +1,253 @@
+using System;
+using System.IO;
+using System.Linq;
+using System.Threading;
+using NUnit.Framework;
+using ParquetSharp.IO;
+
+namespace ParquetSharp.Test
+{
+    [TestFixture]
+    internal static class TestRowRangeReads
+    {
+        [TestCase(true)]
+        [TestCase(false)]
+        public static void TestReadRowRanges(bool writePageIndex)
+        {
+            const int numRows = 10_000;
+            var ids = Enumerable.Range(0, numRows).Select(i => (long) i).ToArray();
+            var values = Enumerable.Range(0, numRows).Select(i => i % 3 == 0 ? null : $"value {i}").ToArray();
+
+            using var buffer = WriteFile(ids, values, writePageIndex);
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupReader = fileReader.RowGroup(0);
+
+            // Unsorted, overlapping and out of bounds ranges are normalized
+            var rowRanges = new[]
+            {
+                new RowRange(9_990, 100),
+                new RowRange(5_000, 10),
+                new RowRange(100, 20),
+                new RowRange(110, 20),
+            };
+            var expectedRows = Enumerable.Range(100, 30)
+                .Concat(Enumerable.Range(5_000, 10))
+                .Concat(Enumerable.Range(9_990, 10))
+                .ToArray();
+
+            using (var columnReader = rowGroupReader.Column(0, rowRanges))
+            {
+                Assert.AreEqual(new[] {new RowRange(100, 30), new RowRange(5_000, 10), new RowRange(9_990, 10)}, columnReader.RowRanges!.ToArray());
+
+                var pageRows = columnReader.PageRowRanges!.Sum(r => r.Length);
+                if (writePageIndex)
+                {
+                    Assert.That(pageRows, Is.LessThan(numRows));
+                }
+                else
+                {
+                    Assert.AreEqual(numRows, pageRows);
+                }
+
+                using var logicalReader = columnReader.LogicalReader<long>();
+                var read = logicalReader.ReadAll(expectedRows.Length);
+
+                Assert.AreEqual(expectedRows.Select(i => ids[i]).ToArray(), read);
+                Assert.IsFalse(logicalReader.HasNext);
+            }
+
+            using (var columnReader = rowGroupReader.Column(1, rowRanges))
+            {
+                using var logicalReader = columnReader.LogicalReader<string?>(bufferLength: 7);
+                var read = logicalReader.ToArray();
+
+                Assert.AreEqual(expectedRows.Select(i => values[i]).ToArray(), read);
+            }
+        }
+
+        [Test]
+        public static void TestSkipWithinRowRanges()
+        {
+            const int numRows = 10_000;
+            var ids = Enumerable.Range(0, numRows).Select(i => (long) i).ToArray();
+            var values = ids.Select(i => (string?) i.ToString()).ToArray();
+
+            using var buffer = WriteFile(ids, values, writePageIndex: true);
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var columnReader = rowGroupReader.Column(0, new[] {new RowRange(1_000, 10), new RowRange(8_000, 10)});
+            using var logicalReader = columnReader.LogicalReader<long>();
+
+            Assert.AreEqual(15, logicalReader.Skip(15));
+            Assert.AreEqual(new long[] {8_005, 8_006}, logicalReader.ReadAll(2));
+            Assert.AreEqual(3, logicalReader.Skip(100));
+            Assert.IsFalse(logicalReader.HasNext);
+        }
+
+        [Test]
+        public static void TestEmptyRowRanges()
+        {
+            var ids = Enumerable.Range(0, 100).Select(i => (long) i).ToArray();
+            var values = ids.Select(i => (string?) i.ToString()).ToArray();
+
+            using var buffer = WriteFile(ids, values, writePageIndex: true);
+            using var input = new BufferReader(buffer);
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var columnReader = rowGroupReader.Column(0, new[] {new RowRange(200, 10)});
+            using var logicalReader = columnReader.LogicalReader<long>();
+
+            Assert.IsFalse(logicalReader.HasNext);
+            Assert.AreEqual(0, logicalReader.ReadBatch(new long[10]));
+        }
+
+        [Test]
+        public static void TestReadsOnlySelectedPages()
+        {
+            const int numRows = 10_000;
+            var ids = Enumerable.Range(0, numRows).Select(i => (long) i).ToArray();
+            var values = Enumerable.Range(0, numRows).Select(i => $"value {i}").ToArray();
+
+            using var buffer = WriteFile(ids, values!, writePageIndex: true);
+            var bytes = buffer.ToArray();
+
+            long bytesRead = 0;
+            using var input = new ManagedRandomAccessFile(new MemoryStream(bytes), leaveOpen: false, readAt: (position, destination) =>
+            {
+                var length = Math.Max(0, Math.Min(destination.Length, bytes.Length - (int) position));
+                bytes.AsSpan((int) position, length).CopyTo(destination);
+                Interlocked.Add(ref bytesRead, length);
+                return length;
+            });
+            using var fileReader = new ParquetFileReader(input);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using var columnChunkMetaData = rowGroupReader.MetaData.GetColumnChunkMetaData(1);
+
+            // Read the page index before counting bytes read for the column data
+            var rowRanges = new[] {new RowRange(5_000, 10)};
+            using var columnReader = rowGroupReader.Column(1, rowRanges);
+            var bytesReadBefore = Interlocked.Read(ref bytesRead);
+
+            using (var logicalReader = columnReader.LogicalReader<string?>())
+            {
+                Assert.AreEqual(values.Skip(5_000).Take(10).ToArray(), logicalReader.ReadAll(10));
+            }
+
+            var columnBytesRead = Interlocked.Read(ref bytesRead) - bytesReadBefore;
+            Assert.That(columnBytesRead, Is.GreaterThan(0));
+            Assert.That(columnBytesRead, Is.LessThan(columnChunkMetaData.TotalCompressedSize / 10));
+        }
+
+        [Test]
+        public static void TestReadSelectedPagesFromPath()
+        {
+            const int numRows = 10_000;
+            var ids = Enumerable.Range(0, numRows).Select(i => (long) i).ToArray();
+            var values = Enumerable.Range(0, numRows).Select(i => i % 3 == 0 ? null : $"value {i % 100}").ToArray();
+
+            using var directory = new TempWorkingDirectory();
+            var path = Path.Combine(directory.DirectoryPath, "file.parquet");
+            using (var buffer = WriteFile(ids, values, writePageIndex: true, enableDictionary: true))
+            {
+                File.WriteAllBytes(path, buffer.ToArray());
+            }
+
+            var rowRanges = new[] {new RowRange(100, 30), new RowRange(9_990, 10)};
+            var expectedRows = Enumerable.Range(100, 30).Concat(Enumerable.Range(9_990, 10)).ToArray();
+
+            using var fileReader = new ParquetFileReader(path);
+            using var rowGroupReader = fileReader.RowGroup(0);
+            using (var columnReader = rowGroupReader.Column(0, rowRanges))
+            {
+                using var logicalReader = columnReader.LogicalReader<long>();
+                Assert.AreEqual(expectedRows.Select(i => ids[i]).ToArray(), logicalReader.ReadAll(expectedRows.Length));
+            }
+            using (var columnReader = rowGroupReader.Column(1, rowRanges))
+            {
+                using var logicalReader = columnReader.LogicalReader<string?>();
+                Assert.AreEqual(expectedRows.Select(i => values[i]).ToArray(), logicalReader.ReadAll(expectedRows.Length));
+            }
+        }
+
+        [Test]
+        public static void TestReadSelectedPagesWithPageChecksumVerification()
+        {
+            const int numRows = 10_000;
+            var ids = Enumerable.Range(0, numRows).Select(i => (long) i).ToArray();
+            var values = ids.Select(i => (string?) i.ToString()).ToArray();
+
+            byte[] bytes;
+            using (var buffer = WriteFile(ids, values, writePageIndex: true, enablePageChecksum: true))
+            {
+                bytes = buffer.ToArray();
+            }
+
+            // Corrupt the end of the last data page of the id column
+            PageLocation lastPage;
+            using (var fileReader = new ParquetFileReader(new MemoryStream(bytes)))
+            using (var pageIndexReader = fileReader.GetPageIndexReader())
+            using (var rowGroupPageIndexReader = pageIndexReader!.RowGroup(0))
+            using (var offsetIndex = rowGroupPageIndexReader!.GetOffsetIndex(0))
+            {
+                lastPage = offsetIndex!.PageLocations.Last();
+            }
+            bytes[lastPage.Offset + lastPage.CompressedPageSize - 1] ^= 0xFF;
+
+            using var readerProperties = ReaderProperties.GetDefaultReaderProperties();
+            readerProperties.EnablePageChecksumVerification();
+
+            using var corruptReader = new ParquetFileReader(new MemoryStream(bytes), readerProperties);
+            using var rowGroupReader = corruptReader.RowGroup(0);
+            using var columnReader = rowGroupReader.Column(0, new[] {new RowRange(numRows - 10, 10)});
+            using var logicalReader = columnReader.LogicalReader<long>();
+
+            var exception = Assert.Throws<ParquetException>(() => logicalReader.ReadAll(10));
+            Assert.That(exception!.Message, Does.Contain("CRC"));
+        }
+
+        private static ResizableBuffer WriteFile(long[] ids, string?[] values, bool writePageIndex, bool enableDictionary = false, bool enablePageChecksum = false)
+        {
+            var columns = new Column[]
+            {
+                new Column<long>("id"),
+                new Column<string?>("value"),
+            };
+
+            using var builder = new WriterPropertiesBuilder();
+            builder.DataPagesize(1024).WriteBatchSize(128);
+            if (!enableDictionary)
+            {
+                builder.DisableDictionary();
+            }
+            if (writePageIndex)
+            {
+                builder.EnableWritePageIndex();
+            }
+            if (enablePageChecksum)
+            {
+                builder.EnablePageChecksum();
+            }
+            using var writerProperties = builder.Build();
+
+            var buffer = new ResizableBuffer();
+            using var output = new BufferOutputStream(buffer);
+            using var fileWriter = new ParquetFileWriter(output, columns, writerProperties);
+            using var rowGroupWriter = fileWriter.AppendRowGroup();
+
+            using (var idWriter = rowGroupWriter.NextColumn().LogicalWriter<long>())
+            {
+                idWriter.WriteBatch(ids);
+            }
+
+            using (var valueWriter = rowGroupWriter.NextColumn().LogicalWriter<string?>())
+            {
+                valueWriter.WriteBatch(values);
+            }
+
+            fileWriter.Close();
+            return buffer;
+        }
+    }
+}
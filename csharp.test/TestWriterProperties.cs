@@ -111,6 +111,36 @@ namespace ParquetSharp.Test
             }
         }
 
+        [Test]
+        public static void TestBloomFilter()
+        {
+            using (var p = new WriterPropertiesBuilder().Build())
+            {
+                Assert.IsNull(p.BloomFilterOptions(new ColumnPath("column_a")));
+            }
+
+            using (var p = new WriterPropertiesBuilder()
+                       .EnableBloomFilter("column_a")
+                       .EnableBloomFilter(new ColumnPath(new[] { "column_b", "nested" }), new BloomFilterOptions(1000, 0.01))
+                       .EnableBloomFilter("column_c")
+                       .DisableBloomFilter("column_c")
+                       .Build())
+            {
+                var optionsA = p.BloomFilterOptions(new ColumnPath("column_a"));
+                Assert.IsNotNull(optionsA);
+                Assert.AreEqual(BloomFilterOptions.Default.Ndv, optionsA!.Value.Ndv);
+                Assert.AreEqual(BloomFilterOptions.Default.Fpp, optionsA.Value.Fpp);
+
+                var optionsB = p.BloomFilterOptions(new ColumnPath("column_b.nested"));
+                Assert.IsNotNull(optionsB);
+                Assert.AreEqual(1000, optionsB!.Value.Ndv);
+                Assert.AreEqual(0.01, optionsB.Value.Fpp);
+
+                Assert.IsNull(p.BloomFilterOptions(new ColumnPath("column_c")));
+                Assert.IsNull(p.BloomFilterOptions(new ColumnPath("column_d")));
+            }
+        }
+
         [Test]
         [NonParallelizable]
         public static void TestOverrideDefaults()
@@ -1,6 +1,9 @@
 using System;
+using System.Collections.Generic;
 using System.IO;
+using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
+using System.Threading;
 using Apache.Arrow.C;
 using Apache.Arrow.Ipc;
 using ParquetSharp.IO;
@@ -24,6 +27,26 @@ namespace ParquetSharp.Arrow
             string path,
             ReaderProperties? properties = null,
             ArrowReaderProperties? arrowProperties = null)
+            : this(path, memoryMap: false, properties, arrowProperties)
+        {
+        }
+
+        /// <summary>
+        /// Create a new Arrow FileReader for a file at the specified path, optionally memory mapping the file
+        /// </summary>
+        /// <remarks>
+        /// When the file is memory mapped, reads are served directly from the operating system page cache
+        /// rather than being copied into buffers allocated from the memory pool.
+        /// </remarks>
+        /// <param name="path">Path to the Parquet file</param>
+        /// <param name="memoryMap">Whether to memory map the file rather than reading it</param>
+        /// <param name="properties">Parquet reader properties</param>
+        /// <param name="arrowProperties">Arrow specific reader properties</param>
+        public FileReader(
+            string path,
+            bool memoryMap,
+            ReaderProperties? properties = null,
+            ArrowReaderProperties? arrowProperties = null)
         {
             using var defaultProperties = properties == null ? ReaderProperties.GetDefaultReaderProperties() : null;
             var readerProperties = properties ?? defaultProperties!;
@@ -31,7 +54,7 @@ namespace ParquetSharp.Arrow
             var arrowPropertiesPtr =
                 arrowProperties == null ? IntPtr.Zero : arrowProperties.Handle.IntPtr;
 
-            ExceptionInfo.Check(FileReader_OpenPath(path, readerProperties.Handle.IntPtr, arrowPropertiesPtr, out var reader));
+            ExceptionInfo.Check(FileReader_OpenPath(path, memoryMap, readerProperties.Handle.IntPtr, arrowPropertiesPtr, out var reader));
 
             _handle = new ParquetHandle(reader, FileReader_Free);
 
@@ -143,6 +166,48 @@ namespace ParquetSharp.Arrow
             return CArrowArrayStreamImporter.ImportArrayStream(&cStream);
         }
 
+#if (NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER)
+        /// <summary>
+        /// Asynchronously read record batches from the file data
+        /// </summary>
+        /// <remarks>
+        /// Row groups are decoded on the Arrow CPU thread pool, so waiting for the next batch doesn't block a thread.
+        /// When <paramref name="rowsToReadahead"/> is greater than zero, following row groups are read and decoded
+        /// while the current batch is being processed, until at least this many rows are in flight.
+        /// Reads are more efficient when <see cref="ArrowReaderProperties.PreBuffer"/> is enabled,
+        /// in which case I/O is also performed asynchronously.
+        /// This reader must not be disposed until enumeration has completed.
+        /// If enumeration stops early, disposing the enumerator waits for any batches being read ahead to finish decoding.
+        /// </remarks>
+        /// <param name="rowGroups">The indices of row groups to read data from</param>
+        /// <param name="columns">The indices of columns to read, based on the schema</param>
+        /// <param name="rowsToReadahead">The number of rows to read ahead of the batch being consumed</param>
+        /// <param name="cancellationToken">Cancels waiting for the next batch</param>
+        /// <returns>An asynchronous sequence of record batches</returns>
+        public async IAsyncEnumerable<Apache.Arrow.RecordBatch> GetRecordBatchesAsync(
+            int[]? rowGroups = null,
+            int[]? columns = null,
+            long rowsToReadahead = 0,
+            [EnumeratorCancellation] CancellationToken cancellationToken = default)
+        {
+            if (rowsToReadahead < 0) throw new ArgumentOutOfRangeException(nameof(rowsToReadahead));
+
+            var generator = new RecordBatchGenerator(this, rowGroups, columns, rowsToReadahead);
+            try
+            {
+                while (await generator.NextAsync(cancellationToken).ConfigureAwait(false) is { } batch)
+                {
+                    yield return batch;
+                }
+            }
+            finally
+            {
+                // Wait for batches being read ahead, so that this reader can be disposed once enumeration stops
+                await generator.DisposeAsync().ConfigureAwait(false);
+            }
+        }
+#endif
+
         /// <summary>
         /// Get the underlying ParquetFileReader used by this Arrow FileReader
         /// </summary>
@@ -167,6 +232,8 @@ namespace ParquetSharp.Arrow
             }
         }
 
+        internal INativeHandle Handle => _handle;
+
         public void Dispose()
         {
             _handle.Dispose();
@@ -178,7 +245,7 @@ namespace ParquetSharp.Arrow
 
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileReader_OpenPath(
-            [MarshalAs(UnmanagedType.LPUTF8Str)] string path, IntPtr properties, IntPtr arrowProperties, out IntPtr reader);
+            [MarshalAs(UnmanagedType.LPUTF8Str)] string path, [MarshalAs(UnmanagedType.I1)] bool memoryMap, IntPtr properties, IntPtr arrowProperties, out IntPtr reader);
 
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileReader_OpenFile(
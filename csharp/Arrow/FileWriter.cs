@@ -58,6 +58,7 @@ namespace ParquetSharp.Arrow
             CArrowSchemaExporter.ExportSchema(schema, &cSchema);
             ExceptionInfo.Check(FileWriter_OpenPath(path, &cSchema, writerPropertiesPtr, arrowPropertiesPtr, out var writer));
             _handle = new ParquetHandle(writer, FileWriter_Free);
+            _maxRowGroupLength = GetMaxRowGroupLength(properties);
 
             GC.KeepAlive(cSchema);
             GC.KeepAlive(properties);
@@ -92,6 +93,7 @@ namespace ParquetSharp.Arrow
             ExceptionInfo.Check(FileWriter_OpenStream(
                 outputStream.Handle.IntPtr, &cSchema, writerPropertiesPtr, arrowPropertiesPtr, out var writer));
             _handle = new ParquetHandle(writer, FileWriter_Free);
+            _maxRowGroupLength = GetMaxRowGroupLength(properties);
             _outputStream = outputStream;
 
             GC.KeepAlive(cSchema);
@@ -131,6 +133,7 @@ namespace ParquetSharp.Arrow
             ExceptionInfo.Check(FileWriter_OpenStream(
                 _outputStream.Handle!.IntPtr, &cSchema, writerPropertiesPtr, arrowPropertiesPtr, out var writer));
             _handle = new ParquetHandle(writer, FileWriter_Free);
+            _maxRowGroupLength = GetMaxRowGroupLength(properties);
 
             GC.KeepAlive(cSchema);
             GC.KeepAlive(properties);
@@ -191,8 +194,49 @@ namespace ParquetSharp.Arrow
         /// <param name="recordBatch">The record batch to write</param>
         public void WriteBufferedRecordBatch(RecordBatch recordBatch)
         {
-            var arrayStream = new RecordBatchStream(recordBatch.Schema, new[] { recordBatch });
-            WriteBufferedRecordBatches(arrayStream);
+            AppendBufferedRecordBatch(recordBatch);
+
+            // The size of the data isn't computed here, so the next sized write starts a new row group
+            _bufferedRowGroupBytes = _bufferedRowGroupRows > 0 ? UnknownSize : 0;
+        }
+
+        /// <summary>
+        /// Write a record batch to Parquet in buffered mode, first starting a new row group
+        /// if writing the record batch would take the current row group past a target size
+        /// in uncompressed Arrow bytes.
+        ///
+        /// The Arrow writer doesn't expose the size of the row group being written,
+        /// so the target is compared with the in-memory size of the Arrow data buffered into the
+        /// row group since it was started, not with its encoded and compressed size in the file.
+        /// Only the parts of buffers referenced by sliced arrays are counted.
+        /// Dictionary encoding and compression often make row groups several times smaller
+        /// in the file than in memory, so the target should be scaled up by the compression ratio
+        /// expected for the data when aiming for a compressed row group size.
+        /// A record batch larger than the target size is written to a row group of its own,
+        /// and new row groups are still started if the data reaches the MaxRowGroupLength
+        /// configured in the <see cref="WriterProperties"/>.
+        /// If record batches were written to the current row group with
+        /// <see cref="WriteBufferedRecordBatch(RecordBatch)"/>, its size is unknown and a new row group is started first.
+        /// </summary>
+        /// <param name="recordBatch">The record batch to write</param>
+        /// <param name="maxRowGroupBytes">The target size of each row group in uncompressed Arrow bytes</param>
+        public void WriteBufferedRecordBatch(RecordBatch recordBatch, long maxRowGroupBytes)
+        {
+            if (maxRowGroupBytes <= 0) throw new ArgumentOutOfRangeException(nameof(maxRowGroupBytes), "maxRowGroupBytes must be positive");
+
+            var size = GetBufferSize(recordBatch);
+            if (_bufferedRowGroupRows > 0 && (_bufferedRowGroupBytes == UnknownSize || _bufferedRowGroupBytes + size > maxRowGroupBytes))
+            {
+                NewBufferedRowGroup();
+            }
+
+            var previousRows = _bufferedRowGroupRows;
+            AppendBufferedRecordBatch(recordBatch);
+
+            // If the writer started new row groups, only the rows written to the last row group count towards its size
+            _bufferedRowGroupBytes = _bufferedRowGroupRows == previousRows + recordBatch.Length
+                ? _bufferedRowGroupBytes + size
+                : size * _bufferedRowGroupRows / recordBatch.Length;
         }
 
         /// <summary>
@@ -204,6 +248,8 @@ namespace ParquetSharp.Arrow
         {
             ExceptionInfo.Check(FileWriter_NewBufferedRowGroup(_handle.IntPtr));
             GC.KeepAlive(_handle);
+            _bufferedRowGroupBytes = 0;
+            _bufferedRowGroupRows = 0;
         }
 
         /// <summary>
@@ -228,6 +274,8 @@ namespace ParquetSharp.Arrow
         {
             ExceptionInfo.Check(FileWriter_NewRowGroup(_handle.IntPtr));
             GC.KeepAlive(_handle);
+            _bufferedRowGroupBytes = 0;
+            _bufferedRowGroupRows = 0;
         }
 
         /// <summary>
@@ -309,6 +357,8 @@ namespace ParquetSharp.Arrow
             ExceptionInfo.Check(FileWriter_WriteTable(_handle.IntPtr, &cArrayStream, chunkSize));
             GC.KeepAlive(cArrayStream);
             GC.KeepAlive(_handle);
+            _bufferedRowGroupBytes = 0;
+            _bufferedRowGroupRows = 0;
         }
 
         /// <summary>
@@ -323,6 +373,49 @@ namespace ParquetSharp.Arrow
             GC.KeepAlive(_handle);
         }
 
+        /// <summary>
+        /// Write a record batch in buffered mode and track the number of rows in the current row group.
+        /// </summary>
+        private void AppendBufferedRecordBatch(RecordBatch recordBatch)
+        {
+            var arrayStream = new RecordBatchStream(recordBatch.Schema, new[] { recordBatch });
+            WriteBufferedRecordBatches(arrayStream);
+
+            // The writer starts new row groups once MaxRowGroupLength rows have been written,
+            // in which case the current row group only holds the last rows of the batch.
+            var rows = _bufferedRowGroupRows + recordBatch.Length;
+            _bufferedRowGroupRows = rows > _maxRowGroupLength ? (rows - 1) % _maxRowGroupLength + 1 : rows;
+        }
+
+        /// <summary>
+        /// Get the total size of the buffer ranges referenced by a record batch.
+        /// Only the parts of buffers covered by sliced arrays are counted.
+        /// </summary>
+        private static unsafe long GetBufferSize(RecordBatch recordBatch)
+        {
+            var cArray = new CArrowArray();
+            var cSchema = new CArrowSchema();
+
+            CArrowArrayExporter.ExportRecordBatch(recordBatch, &cArray);
+            CArrowSchemaExporter.ExportSchema(recordBatch.Schema, &cSchema);
+            ExceptionInfo.Check(FileWriter_ReferencedBufferSize(&cArray, &cSchema, out var size));
+
+            GC.KeepAlive(cArray);
+            GC.KeepAlive(cSchema);
+            return size;
+        }
+
+        private static long GetMaxRowGroupLength(WriterProperties? properties)
+        {
+            if (properties != null)
+            {
+                return properties.MaxRowGroupLength;
+            }
+
+            using var defaultProperties = WriterProperties.GetDefaultWriterProperties();
+            return defaultProperties.MaxRowGroupLength;
+        }
+
         [DllImport(ParquetDll.Name)]
         private static extern unsafe IntPtr FileWriter_OpenPath(
             [MarshalAs(UnmanagedType.LPUTF8Str)] string path, CArrowSchema* schema, IntPtr properties, IntPtr arrowProperties, out IntPtr writer);
@@ -340,6 +433,9 @@ namespace ParquetSharp.Arrow
         [DllImport(ParquetDll.Name)]
         private static extern unsafe IntPtr FileWriter_WriteRecordBatches(IntPtr writer, CArrowArrayStream* stream);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr FileWriter_ReferencedBufferSize(CArrowArray* array, CArrowSchema* schema, out long size);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileWriter_NewRowGroup(IntPtr writer);
 
@@ -361,6 +457,11 @@ namespace ParquetSharp.Arrow
         private readonly ParquetHandle _handle;
         private readonly OutputStream? _outputStream; // Keep a handle to the output stream to prevent GC
         private readonly bool _ownedStream; // Whether this writer created the OutputStream
+        private readonly long _maxRowGroupLength;
+        private long _bufferedRowGroupBytes; // Size of the Arrow data buffered into the current row group
+        private long _bufferedRowGroupRows; // Number of rows buffered into the current row group
+
+        private const long UnknownSize = -1;
 
         /// <summary>
         /// A stream of record batches where batches are all stored in memory
@@ -0,0 +1,171 @@
+using System;
+using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+using Apache.Arrow;
+using Apache.Arrow.C;
+
+namespace ParquetSharp.Arrow
+{
+    /// <summary>
+    /// Wraps an Arrow asynchronous record batch generator, completing a task when each batch has been decoded.
+    /// </summary>
+    /// <remarks>
+    /// Only one batch may be requested at a time. The native generator is freed once any outstanding request completes,
+    /// so the generator can be disposed while a batch is still being read.
+    /// Batches being read ahead continue to be decoded after the generator is freed,
+    /// so this object, and with it the file reader and any managed input file, stays alive until they have finished.
+    /// <see cref="DisposeAsync"/> waits for this.
+    /// </remarks>
+    internal sealed class RecordBatchGenerator : IDisposable
+    {
+        public unsafe RecordBatchGenerator(FileReader fileReader, int[]? rowGroups, int[]? columns, long rowsToReadahead)
+        {
+            _fileReader = fileReader;
+            _onNext = OnNext;
+            _onReleased = OnReleased;
+            _root = GCHandle.Alloc(this);
+
+            // If creating the generator fails, the released callback has already been called
+            fixed (int* rowGroupsPtr = rowGroups)
+            fixed (int* columnsPtr = columns)
+            {
+                ExceptionInfo.Check(RecordBatchGenerator_Create(
+                    fileReader.Handle.IntPtr, rowGroupsPtr, rowGroups?.Length ?? 0, columnsPtr, columns?.Length ?? 0, rowsToReadahead, _onReleased, out var handle));
+                _handle = new ParquetHandle(handle, RecordBatchGenerator_Free);
+            }
+        }
+
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                _disposed = true;
+                if (_pending == null)
+                {
+                    _handle.Dispose();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Free the generator and wait until reads in flight, including any outstanding request, have finished using the file reader.
+        /// </summary>
+        public Task DisposeAsync()
+        {
+            Dispose();
+            return _released.Task;
+        }
+
+        /// <summary>
+        /// Request the next record batch.
+        /// </summary>
+        /// <returns>The next batch, or null at the end of the stream</returns>
+        public Task<RecordBatch?> NextAsync(CancellationToken cancellationToken)
+        {
+            cancellationToken.ThrowIfCancellationRequested();
+
+            lock (_lock)
+            {
+                if (_disposed) throw new ObjectDisposedException(nameof(RecordBatchGenerator));
+                if (_pending != null) throw new InvalidOperationException("the previous record batch has not been read yet");
+
+                var pending = new TaskCompletionSource<RecordBatch?>(TaskCreationOptions.RunContinuationsAsynchronously);
+                _pending = pending;
+
+                var exceptionInfo = RecordBatchGenerator_Next(_handle.IntPtr, _onNext);
+                if (exceptionInfo != IntPtr.Zero)
+                {
+                    _pending = null;
+                    ExceptionInfo.Check(exceptionInfo);
+                }
+
+                return cancellationToken.CanBeCanceled ? WithCancellation(pending.Task, cancellationToken) : pending.Task;
+            }
+        }
+
+        private static async Task<RecordBatch?> WithCancellation(Task<RecordBatch?> task, CancellationToken cancellationToken)
+        {
+            var cancelled = new TaskCompletionSource<RecordBatch?>(TaskCreationOptions.RunContinuationsAsynchronously);
+            using (cancellationToken.Register(() => cancelled.TrySetCanceled(cancellationToken)))
+            {
+                return await await Task.WhenAny(task, cancelled.Task).ConfigureAwait(false);
+            }
+        }
+
+        private unsafe void OnNext(CArrowArray* array, CArrowSchema* schema, string? error)
+        {
+            TaskCompletionSource<RecordBatch?> pending;
+            lock (_lock)
+            {
+                pending = _pending!;
+                _pending = null;
+            }
+
+            try
+            {
+                if (error != null)
+                {
+                    pending.SetException(new ParquetException("arrow::Status", error));
+                }
+                else if (array == null)
+                {
+                    pending.SetResult(null);
+                }
+                else
+                {
+                    if (schema != null)
+                    {
+                        _schema = CArrowSchemaImporter.ImportSchema(schema);
+                    }
+                    pending.SetResult(CArrowArrayImporter.ImportRecordBatch(array, _schema!));
+                }
+            }
+            catch (Exception exception)
+            {
+                pending.TrySetException(exception);
+            }
+            finally
+            {
+                lock (_lock)
+                {
+                    if (_disposed)
+                    {
+                        _handle.Dispose();
+                    }
+                }
+            }
+        }
+
+        private void OnReleased()
+        {
+            _root.Free();
+            _released.TrySetResult(true);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr RecordBatchGenerator_Create(
+            IntPtr reader, int* rowGroups, int rowGroupsCount, int* columns, int columnsCount, long rowsToReadahead, ReleasedCallback released, out IntPtr generator);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr RecordBatchGenerator_Next(IntPtr generator, NextBatchCallback callback);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void RecordBatchGenerator_Free(IntPtr generator);
+
+        private unsafe delegate void NextBatchCallback(CArrowArray* array, CArrowSchema* schema, [MarshalAs(UnmanagedType.LPUTF8Str)] string? error);
+
+        private delegate void ReleasedCallback();
+
+        private readonly ParquetHandle _handle;
+        private readonly FileReader _fileReader; // Keep the reader and any managed input file alive while reads are in flight
+        private readonly NextBatchCallback _onNext; // Keep the delegate alive for as long as native code may call it
+        private readonly ReleasedCallback _onReleased;
+        private readonly TaskCompletionSource<bool> _released = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        private readonly object _lock = new();
+        private TaskCompletionSource<RecordBatch?>? _pending;
+        private GCHandle _root; // Keeps this object alive until native code has released the file reader
+        private Apache.Arrow.Schema? _schema;
+        private bool _disposed;
+    }
+}
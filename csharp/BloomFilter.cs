@@ -0,0 +1,522 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// A split block bloom filter for a column chunk, used to test whether a value might be present
+    /// in the column chunk without reading its data pages.
+    /// </summary>
+    /// <remarks>
+    /// Values are hashed with the same xxHash64 function that is used when writing the filter,
+    /// so must be given as the column's physical type (e.g. as a UTF-8 <see cref="ByteArray"/> for string columns).
+    /// When the same keys are tested against many filters, they can be hashed once with one of the
+    /// <c>Hash</c> methods and then tested with <see cref="FindHashes"/>.
+    /// </remarks>
+    public sealed class BloomFilter : IDisposable
+    {
+        internal BloomFilter(IntPtr handle, PhysicalType physicalType, int typeLength)
+        {
+            _handle = new ParquetHandle(handle, BloomFilter_Free);
+            PhysicalType = physicalType;
+            TypeLength = typeLength;
+        }
+
+        public void Dispose()
+        {
+            _handle.Dispose();
+        }
+
+        /// <summary>
+        /// The physical type of the column this filter was built for.
+        /// </summary>
+        public PhysicalType PhysicalType { get; }
+
+        /// <summary>
+        /// The length of values for fixed-length byte array columns.
+        /// </summary>
+        public int TypeLength { get; }
+
+        /// <summary>
+        /// The size of the filter bitset in bytes.
+        /// </summary>
+        public uint BitsetSize => ExceptionInfo.Return<uint>(_handle, BloomFilter_Get_Bitset_Size);
+
+        /// <summary>
+        /// Test whether a value might be present. A false result means the value is definitely not present.
+        /// </summary>
+        public bool MightContain(int value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <inheritdoc cref="MightContain(int)"/>
+        public bool MightContain(long value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <inheritdoc cref="MightContain(int)"/>
+        public bool MightContain(float value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <inheritdoc cref="MightContain(int)"/>
+        public bool MightContain(double value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <inheritdoc cref="MightContain(int)"/>
+        public bool MightContain(Int96 value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <inheritdoc cref="MightContain(int)"/>
+        public bool MightContain(ByteArray value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <inheritdoc cref="MightContain(int)"/>
+        public bool MightContain(FixedLenByteArray value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(stackalloc[] {value}, found);
+            return found[0];
+        }
+
+        /// <summary>
+        /// Test whether a byte array value might be present in a byte array or fixed-length byte array column.
+        /// A false result means the value is definitely not present.
+        /// </summary>
+        public bool MightContain(byte[] value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(new[] {value}, found);
+            return found[0];
+        }
+
+        /// <summary>
+        /// Test whether a string might be present in a byte array column of UTF-8 strings.
+        /// A false result means the value is definitely not present.
+        /// </summary>
+        public bool MightContain(string value)
+        {
+            Span<bool> found = stackalloc bool[1];
+            MightContain(new[] {value}, found);
+            return found[0];
+        }
+
+        /// <summary>
+        /// Test whether each of the given values might be present, using a single native call.
+        /// </summary>
+        /// <param name="values">The values to test</param>
+        /// <param name="found">Receives false for each value that is definitely not present, and true otherwise.
+        /// Must be at least as long as <paramref name="values"/>.</param>
+        public unsafe void MightContain(ReadOnlySpan<int> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.Int32, values.Length, found.Length);
+            fixed (int* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_Int32(_handle.IntPtr, pValues, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<long> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.Int64, values.Length, found.Length);
+            fixed (long* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_Int64(_handle.IntPtr, pValues, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<float> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.Float, values.Length, found.Length);
+            fixed (float* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_Float(_handle.IntPtr, pValues, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<double> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.Double, values.Length, found.Length);
+            fixed (double* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_Double(_handle.IntPtr, pValues, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<Int96> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.Int96, values.Length, found.Length);
+            fixed (Int96* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_Int96(_handle.IntPtr, pValues, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<ByteArray> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.ByteArray, values.Length, found.Length);
+            fixed (ByteArray* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_ByteArray(_handle.IntPtr, pValues, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<FixedLenByteArray> values, Span<bool> found)
+        {
+            CheckArguments(PhysicalType.FixedLenByteArray, values.Length, found.Length);
+            fixed (FixedLenByteArray* pValues = values)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Might_Contain_FLBA(_handle.IntPtr, pValues, (uint) TypeLength, values.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<byte[]> values, Span<bool> found)
+        {
+            CheckBytesArguments(values.Length, found.Length);
+            var buffer = Pack(values, out var offsets);
+            fixed (bool* pFound = found)
+            {
+                ProcessPacked(buffer, offsets, null, pFound);
+            }
+        }
+
+        /// <inheritdoc cref="MightContain(ReadOnlySpan{int}, Span{bool})"/>
+        public unsafe void MightContain(ReadOnlySpan<string> values, Span<bool> found)
+        {
+            CheckBytesArguments(values.Length, found.Length);
+            var buffer = Pack(values, out var offsets);
+            fixed (bool* pFound = found)
+            {
+                ProcessPacked(buffer, offsets, null, pFound);
+            }
+        }
+
+        /// <summary>
+        /// Compute the bloom filter hashes of the given values, for use with <see cref="FindHashes"/>.
+        /// </summary>
+        /// <param name="values">The values to hash</param>
+        /// <param name="hashes">Receives the hash of each value. Must be at least as long as <paramref name="values"/>.</param>
+        public unsafe void Hash(ReadOnlySpan<int> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.Int32, values.Length, hashes.Length);
+            fixed (int* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_Int32(_handle.IntPtr, pValues, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<long> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.Int64, values.Length, hashes.Length);
+            fixed (long* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_Int64(_handle.IntPtr, pValues, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<float> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.Float, values.Length, hashes.Length);
+            fixed (float* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_Float(_handle.IntPtr, pValues, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<double> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.Double, values.Length, hashes.Length);
+            fixed (double* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_Double(_handle.IntPtr, pValues, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<Int96> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.Int96, values.Length, hashes.Length);
+            fixed (Int96* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_Int96(_handle.IntPtr, pValues, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<ByteArray> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.ByteArray, values.Length, hashes.Length);
+            fixed (ByteArray* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_ByteArray(_handle.IntPtr, pValues, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<FixedLenByteArray> values, Span<ulong> hashes)
+        {
+            CheckArguments(PhysicalType.FixedLenByteArray, values.Length, hashes.Length);
+            fixed (FixedLenByteArray* pValues = values)
+            fixed (ulong* pHashes = hashes)
+            {
+                ExceptionInfo.Check(BloomFilter_Hashes_FLBA(_handle.IntPtr, pValues, (uint) TypeLength, values.Length, pHashes));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<byte[]> values, Span<ulong> hashes)
+        {
+            CheckBytesArguments(values.Length, hashes.Length);
+            var buffer = Pack(values, out var offsets);
+            fixed (ulong* pHashes = hashes)
+            {
+                ProcessPacked(buffer, offsets, pHashes, null);
+            }
+        }
+
+        /// <inheritdoc cref="Hash(ReadOnlySpan{int}, Span{ulong})"/>
+        public unsafe void Hash(ReadOnlySpan<string> values, Span<ulong> hashes)
+        {
+            CheckBytesArguments(values.Length, hashes.Length);
+            var buffer = Pack(values, out var offsets);
+            fixed (ulong* pHashes = hashes)
+            {
+                ProcessPacked(buffer, offsets, pHashes, null);
+            }
+        }
+
+        /// <summary>
+        /// Test whether each of the given hashes might be present, using a single native call.
+        /// </summary>
+        /// <param name="hashes">Hashes computed with one of the <c>Hash</c> methods</param>
+        /// <param name="found">Receives false for each hash that is definitely not present, and true otherwise.
+        /// Must be at least as long as <paramref name="hashes"/>.</param>
+        public unsafe void FindHashes(ReadOnlySpan<ulong> hashes, Span<bool> found)
+        {
+            if (found.Length < hashes.Length)
+            {
+                throw new ArgumentException($"output span length ({found.Length}) is less than the number of hashes ({hashes.Length})", nameof(found));
+            }
+            fixed (ulong* pHashes = hashes)
+            fixed (bool* pFound = found)
+            {
+                ExceptionInfo.Check(BloomFilter_Find_Hashes(_handle.IntPtr, pHashes, hashes.Length, pFound));
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        private void CheckArguments(PhysicalType physicalType, int numValues, int outputLength)
+        {
+            if (PhysicalType != physicalType)
+            {
+                throw new ArgumentException($"cannot probe a bloom filter for a {PhysicalType} column with {physicalType} values");
+            }
+            if (outputLength < numValues)
+            {
+                throw new ArgumentException($"output span length ({outputLength}) is less than the number of values ({numValues})");
+            }
+        }
+
+        private void CheckBytesArguments(int numValues, int outputLength)
+        {
+            if (PhysicalType != PhysicalType.ByteArray && PhysicalType != PhysicalType.FixedLenByteArray)
+            {
+                throw new ArgumentException($"cannot probe a bloom filter for a {PhysicalType} column with byte array values");
+            }
+            if (outputLength < numValues)
+            {
+                throw new ArgumentException($"output span length ({outputLength}) is less than the number of values ({numValues})");
+            }
+        }
+
+        private static byte[] Pack(ReadOnlySpan<byte[]> values, out int[] offsets)
+        {
+            offsets = new int[values.Length + 1];
+            for (var i = 0; i != values.Length; ++i)
+            {
+                offsets[i + 1] = offsets[i] + (values[i] ?? throw new ArgumentNullException(nameof(values), "bloom filter values cannot be null")).Length;
+            }
+
+            var buffer = new byte[offsets[values.Length]];
+            for (var i = 0; i != values.Length; ++i)
+            {
+                Buffer.BlockCopy(values[i], 0, buffer, offsets[i], values[i].Length);
+            }
+            return buffer;
+        }
+
+        private static byte[] Pack(ReadOnlySpan<string> values, out int[] offsets)
+        {
+            offsets = new int[values.Length + 1];
+            for (var i = 0; i != values.Length; ++i)
+            {
+                offsets[i + 1] = offsets[i] + System.Text.Encoding.UTF8.GetByteCount(values[i] ?? throw new ArgumentNullException(nameof(values), "bloom filter values cannot be null"));
+            }
+
+            var buffer = new byte[offsets[values.Length]];
+            for (var i = 0; i != values.Length; ++i)
+            {
+                System.Text.Encoding.UTF8.GetBytes(values[i], 0, values[i].Length, buffer, offsets[i]);
+            }
+            return buffer;
+        }
+
+        /// <summary>
+        /// Hash or probe values packed contiguously into a buffer, where exactly one of hashes and found is non-null.
+        /// </summary>
+        private unsafe void ProcessPacked(byte[] buffer, int[] offsets, ulong* hashes, bool* found)
+        {
+            var numValues = offsets.Length - 1;
+
+            fixed (byte* pBuffer = buffer)
+            {
+                if (PhysicalType == PhysicalType.ByteArray)
+                {
+                    var byteArrays = new ByteArray[numValues];
+                    for (var i = 0; i != numValues; ++i)
+                    {
+                        byteArrays[i] = new ByteArray((IntPtr) (pBuffer + offsets[i]), offsets[i + 1] - offsets[i]);
+                    }
+
+                    fixed (ByteArray* pValues = byteArrays)
+                    {
+                        ExceptionInfo.Check(hashes != null
+                            ? BloomFilter_Hashes_ByteArray(_handle.IntPtr, pValues, numValues, hashes)
+                            : BloomFilter_Might_Contain_ByteArray(_handle.IntPtr, pValues, numValues, found));
+                    }
+                }
+                else
+                {
+                    var fixedLenByteArrays = new FixedLenByteArray[numValues];
+                    for (var i = 0; i != numValues; ++i)
+                    {
+                        if (offsets[i + 1] - offsets[i] != TypeLength)
+                        {
+                            throw new ArgumentException($"value length ({offsets[i + 1] - offsets[i]}) does not match the column type length ({TypeLength})");
+                        }
+                        fixedLenByteArrays[i] = new FixedLenByteArray((IntPtr) (pBuffer + offsets[i]));
+                    }
+
+                    fixed (FixedLenByteArray* pValues = fixedLenByteArrays)
+                    {
+                        ExceptionInfo.Check(hashes != null
+                            ? BloomFilter_Hashes_FLBA(_handle.IntPtr, pValues, (uint) TypeLength, numValues, hashes)
+                            : BloomFilter_Might_Contain_FLBA(_handle.IntPtr, pValues, (uint) TypeLength, numValues, found));
+                    }
+                }
+            }
+            GC.KeepAlive(_handle);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void BloomFilter_Free(IntPtr bloomFilter);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr BloomFilter_Get_Bitset_Size(IntPtr bloomFilter, out uint bitsetSize);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Find_Hashes(IntPtr bloomFilter, ulong* hashes, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_Int32(IntPtr bloomFilter, int* values, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_Int64(IntPtr bloomFilter, long* values, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_Float(IntPtr bloomFilter, float* values, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_Double(IntPtr bloomFilter, double* values, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_Int96(IntPtr bloomFilter, Int96* values, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_ByteArray(IntPtr bloomFilter, ByteArray* values, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Hashes_FLBA(IntPtr bloomFilter, FixedLenByteArray* values, uint typeLength, int numValues, ulong* hashes);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_Int32(IntPtr bloomFilter, int* values, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_Int64(IntPtr bloomFilter, long* values, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_Float(IntPtr bloomFilter, float* values, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_Double(IntPtr bloomFilter, double* values, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_Int96(IntPtr bloomFilter, Int96* values, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_ByteArray(IntPtr bloomFilter, ByteArray* values, int numValues, bool* found);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr BloomFilter_Might_Contain_FLBA(IntPtr bloomFilter, FixedLenByteArray* values, uint typeLength, int numValues, bool* found);
+
+        private readonly ParquetHandle _handle;
+    }
+}
@@ -0,0 +1,36 @@
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Options used to size the bloom filter written for a column.
+    /// </summary>
+    public readonly struct BloomFilterOptions
+    {
+        /// <summary>
+        /// Create bloom filter options.
+        /// </summary>
+        /// <param name="ndv">The expected number of distinct values in a column chunk.</param>
+        /// <param name="fpp">The target false positive probability, between 0 and 1 exclusive.</param>
+        public BloomFilterOptions(int ndv, double fpp)
+        {
+            Ndv = ndv;
+            Fpp = fpp;
+        }
+
+        /// <summary>
+        /// The expected number of distinct values in a column chunk.
+        /// The bloom filter is sized so that inserting this many distinct values
+        /// gives a false positive probability of <see cref="Fpp"/>.
+        /// </summary>
+        public readonly int Ndv;
+
+        /// <summary>
+        /// The target false positive probability.
+        /// </summary>
+        public readonly double Fpp;
+
+        /// <summary>
+        /// The default options used by Arrow: one million distinct values with a false positive probability of 5%.
+        /// </summary>
+        public static BloomFilterOptions Default => new BloomFilterOptions(1 << 20, 0.05);
+    }
+}
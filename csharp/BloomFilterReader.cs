@@ -0,0 +1,40 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Reads the bloom filters of a Parquet file.
+    /// </summary>
+    /// <remarks>
+    /// Bloom filters are only written for columns where they have been enabled with
+    /// <see cref="WriterPropertiesBuilder.EnableBloomFilter(string, BloomFilterOptions)"/>.
+    /// This reader is owned by the <see cref="ParquetFileReader"/> it was obtained from,
+    /// and cannot be used after that reader is disposed.
+    /// </remarks>
+    public sealed class BloomFilterReader
+    {
+        internal BloomFilterReader(INativeHandle handle, ParquetFileReader parquetFileReader)
+        {
+            _handle = handle;
+            _parquetFileReader = parquetFileReader;
+        }
+
+        /// <summary>
+        /// Get the bloom filter reader for the specified row group.
+        /// </summary>
+        /// <param name="i">The row group index</param>
+        /// <returns>A <see cref="RowGroupBloomFilterReader"/>, or null if the row group has no bloom filters</returns>
+        public RowGroupBloomFilterReader? RowGroup(int i)
+        {
+            var handle = ExceptionInfo.Return<int, IntPtr>(_handle, i, BloomFilterReader_RowGroup);
+            return handle == IntPtr.Zero ? null : new RowGroupBloomFilterReader(handle, _parquetFileReader);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr BloomFilterReader_RowGroup(IntPtr bloomFilterReader, int i, out IntPtr rowGroupBloomFilterReader);
+
+        private readonly INativeHandle _handle;
+        private readonly ParquetFileReader _parquetFileReader;
+    }
+}
@@ -0,0 +1,21 @@
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Describes how the per-page min and max values of a <see cref="ColumnIndex"/> are ordered.
+    /// </summary>
+    public enum BoundaryOrder
+    {
+        /// <summary>
+        /// The page min and max values are not ordered.
+        /// </summary>
+        Unordered = 0,
+        /// <summary>
+        /// The page min and max values are in ascending order.
+        /// </summary>
+        Ascending = 1,
+        /// <summary>
+        /// The page min and max values are in descending order.
+        /// </summary>
+        Descending = 2
+    }
+}
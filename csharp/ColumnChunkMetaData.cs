@@ -68,6 +68,11 @@ namespace ParquetSharp
         /// </summary>
         public long FileOffset => ExceptionInfo.Return<long>(_handle, ColumnChunkMetaData_File_Offset);
         /// <summary>
+        /// Whether all data pages in the column chunk are dictionary encoded, according to the page encoding statistics.
+        /// This is false if the writer fell back to plain encoding, or if the file doesn't record page encoding statistics.
+        /// </summary>
+        public bool IsFullyDictionaryEncoded => ExceptionInfo.Return<bool>(_handle, ColumnChunkMetaData_Is_Fully_Dictionary_Encoded);
+        /// <summary>
         /// Whether the column chunk statistics are present in the metadata.
         /// </summary>
         public bool IsStatsSet => ExceptionInfo.Return<bool>(_handle, ColumnChunkMetaData_Is_Stats_Set);
@@ -112,6 +117,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr ColumnChunkMetaData_File_Offset(IntPtr columnChunkMetaData, out long fileOffset);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ColumnChunkMetaData_Is_Fully_Dictionary_Encoded(IntPtr columnChunkMetaData, [MarshalAs(UnmanagedType.I1)] out bool isFullyDictionaryEncoded);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr ColumnChunkMetaData_Is_Stats_Set(IntPtr columnChunkMetaData, [MarshalAs(UnmanagedType.I1)] out bool isStatsSet);
 
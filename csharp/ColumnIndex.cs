@@ -0,0 +1,274 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// The column index of a column chunk, which records the min and max values and null information of each data page.
+    /// </summary>
+    /// <remarks>
+    /// Values are ordered according to the column's <see cref="ColumnDescriptor.SortOrder"/>.
+    /// Min and max values of pages that only contain nulls (see <see cref="NullPages"/>) are undefined.
+    /// </remarks>
+    public abstract class ColumnIndex : IDisposable
+    {
+        internal static ColumnIndex? Create(IntPtr handle, PhysicalType type)
+        {
+            if (handle == IntPtr.Zero)
+            {
+                return null;
+            }
+
+            var parquetHandle = new ParquetHandle(handle, ColumnIndex_Free);
+
+            try
+            {
+                return type switch
+                {
+                    PhysicalType.Boolean => new ColumnIndex<bool>(parquetHandle),
+                    PhysicalType.Int32 => new ColumnIndex<int>(parquetHandle),
+                    PhysicalType.Int64 => new ColumnIndex<long>(parquetHandle),
+                    PhysicalType.Float => new ColumnIndex<float>(parquetHandle),
+                    PhysicalType.Double => new ColumnIndex<double>(parquetHandle),
+                    PhysicalType.ByteArray => new ColumnIndex<ByteArray>(parquetHandle),
+                    PhysicalType.FixedLenByteArray => new ColumnIndex<FixedLenByteArray>(parquetHandle),
+                    _ => throw new NotSupportedException($"Physical type {type} is not supported")
+                };
+            }
+
+            catch
+            {
+                parquetHandle.Dispose();
+                throw;
+            }
+        }
+
+        internal ColumnIndex(ParquetHandle handle)
+        {
+            Handle = handle;
+        }
+
+        public void Dispose()
+        {
+            Handle.Dispose();
+        }
+
+        /// <summary>
+        /// The number of data pages in the column chunk.
+        /// </summary>
+        public int NumPages => ExceptionInfo.Return<int>(Handle, ColumnIndex_Num_Pages);
+
+        /// <summary>
+        /// The ordering of the page min and max values.
+        /// </summary>
+        public BoundaryOrder BoundaryOrder => ExceptionInfo.Return<BoundaryOrder>(Handle, ColumnIndex_Boundary_Order);
+
+        /// <summary>
+        /// Whether <see cref="NullCounts"/> are available.
+        /// </summary>
+        public bool HasNullCounts => ExceptionInfo.Return<bool>(Handle, ColumnIndex_Has_Null_Counts);
+
+        /// <summary>
+        /// For each page, whether the page contains only null values.
+        /// </summary>
+        public unsafe bool[] NullPages
+        {
+            get
+            {
+                var nullPages = new bool[NumPages];
+                fixed (bool* pNullPages = nullPages)
+                {
+                    ExceptionInfo.Check(ColumnIndex_Null_Pages(Handle.IntPtr, pNullPages));
+                }
+                GC.KeepAlive(Handle);
+                return nullPages;
+            }
+        }
+
+        /// <summary>
+        /// For each page, the number of null values, or an empty array if <see cref="HasNullCounts"/> is false.
+        /// </summary>
+        public unsafe long[] NullCounts
+        {
+            get
+            {
+                if (!HasNullCounts)
+                {
+                    return Array.Empty<long>();
+                }
+
+                var nullCounts = new long[NumPages];
+                fixed (long* pNullCounts = nullCounts)
+                {
+                    ExceptionInfo.Check(ColumnIndex_Null_Counts(Handle.IntPtr, pNullCounts));
+                }
+                GC.KeepAlive(Handle);
+                return nullCounts;
+            }
+        }
+
+        public abstract Array MinValuesUntyped { get; }
+        public abstract Array MaxValuesUntyped { get; }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void ColumnIndex_Free(IntPtr columnIndex);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ColumnIndex_Num_Pages(IntPtr columnIndex, out int numPages);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr ColumnIndex_Null_Pages(IntPtr columnIndex, bool* nullPages);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ColumnIndex_Has_Null_Counts(IntPtr columnIndex, [MarshalAs(UnmanagedType.I1)] out bool hasNullCounts);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr ColumnIndex_Null_Counts(IntPtr columnIndex, long* nullCounts);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ColumnIndex_Boundary_Order(IntPtr columnIndex, out BoundaryOrder boundaryOrder);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_Bool(IntPtr columnIndex, bool* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_Int32(IntPtr columnIndex, int* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_Int64(IntPtr columnIndex, long* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_Float(IntPtr columnIndex, float* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_Double(IntPtr columnIndex, double* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_ByteArray(IntPtr columnIndex, ByteArray* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Min_Values_FLBA(IntPtr columnIndex, FixedLenByteArray* minValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_Bool(IntPtr columnIndex, bool* maxValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_Int32(IntPtr columnIndex, int* maxValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_Int64(IntPtr columnIndex, long* maxValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_Float(IntPtr columnIndex, float* maxValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_Double(IntPtr columnIndex, double* maxValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_ByteArray(IntPtr columnIndex, ByteArray* maxValues);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnIndex_Max_Values_FLBA(IntPtr columnIndex, FixedLenByteArray* maxValues);
+
+        internal readonly ParquetHandle Handle;
+    }
+
+    /// <inheritdoc />
+    /// <remarks>
+    /// <see cref="ByteArray"/> and <see cref="FixedLenByteArray"/> values point into memory owned by this column index,
+    /// and are only valid until it is disposed.
+    /// </remarks>
+    public sealed class ColumnIndex<TValue> : ColumnIndex where TValue : unmanaged
+    {
+        internal ColumnIndex(ParquetHandle handle)
+            : base(handle)
+        {
+        }
+
+        public override Array MinValuesUntyped => MinValues;
+        public override Array MaxValuesUntyped => MaxValues;
+
+        /// <summary>
+        /// The min value of each page.
+        /// </summary>
+        public TValue[] MinValues => GetValues(min: true);
+
+        /// <summary>
+        /// The max value of each page.
+        /// </summary>
+        public TValue[] MaxValues => GetValues(min: false);
+
+        private unsafe TValue[] GetValues(bool min)
+        {
+            var values = new TValue[NumPages];
+            var type = typeof(TValue);
+
+            fixed (TValue* pValues = values)
+            {
+                if (type == typeof(bool))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_Bool(Handle.IntPtr, (bool*) pValues)
+                        : TypedColumnIndex_Max_Values_Bool(Handle.IntPtr, (bool*) pValues));
+                }
+                else if (type == typeof(int))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_Int32(Handle.IntPtr, (int*) pValues)
+                        : TypedColumnIndex_Max_Values_Int32(Handle.IntPtr, (int*) pValues));
+                }
+                else if (type == typeof(long))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_Int64(Handle.IntPtr, (long*) pValues)
+                        : TypedColumnIndex_Max_Values_Int64(Handle.IntPtr, (long*) pValues));
+                }
+                else if (type == typeof(float))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_Float(Handle.IntPtr, (float*) pValues)
+                        : TypedColumnIndex_Max_Values_Float(Handle.IntPtr, (float*) pValues));
+                }
+                else if (type == typeof(double))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_Double(Handle.IntPtr, (double*) pValues)
+                        : TypedColumnIndex_Max_Values_Double(Handle.IntPtr, (double*) pValues));
+                }
+                else if (type == typeof(ByteArray))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_ByteArray(Handle.IntPtr, (ByteArray*) pValues)
+                        : TypedColumnIndex_Max_Values_ByteArray(Handle.IntPtr, (ByteArray*) pValues));
+                }
+                else if (type == typeof(FixedLenByteArray))
+                {
+                    ExceptionInfo.Check(min
+                        ? TypedColumnIndex_Min_Values_FLBA(Handle.IntPtr, (FixedLenByteArray*) pValues)
+                        : TypedColumnIndex_Max_Values_FLBA(Handle.IntPtr, (FixedLenByteArray*) pValues));
+                }
+                else
+                {
+                    throw new NotSupportedException($"type {type} is not supported");
+                }
+            }
+
+            GC.KeepAlive(Handle);
+            return values;
+        }
+    }
+}
@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 
 namespace ParquetSharp
@@ -8,65 +9,72 @@ namespace ParquetSharp
     /// </summary>
     public abstract class ColumnReader : IDisposable
     {
-        internal static ColumnReader Create(IntPtr handle, RowGroupReader rowGroupReader, ColumnChunkMetaData columnChunkMetaData, int columnIndex)
+        /// <summary>
+        /// Create a column reader whose native reader is only created once it is first needed,
+        /// so that no pages are read for readers that read the column chunk through another native reader.
+        /// </summary>
+        internal static ColumnReader Create(Func<IntPtr> createHandle, RowGroupReader rowGroupReader, ColumnChunkMetaData columnChunkMetaData, int columnIndex, RowRangeSelection? rowRangeSelection = null)
         {
-            var parquetHandle = new ParquetHandle(handle, ColumnReader_Free);
-
-            try
-            {
-                var type = ExceptionInfo.Return<PhysicalType>(handle, ColumnReader_Type);
-
-                switch (type)
-                {
-                    case PhysicalType.Boolean:
-                        return new ColumnReader<bool>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.Int32:
-                        return new ColumnReader<int>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.Int64:
-                        return new ColumnReader<long>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.Int96:
-                        return new ColumnReader<Int96>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.Float:
-                        return new ColumnReader<float>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.Double:
-                        return new ColumnReader<double>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.ByteArray:
-                        return new ColumnReader<ByteArray>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    case PhysicalType.FixedLenByteArray:
-                        return new ColumnReader<FixedLenByteArray>(parquetHandle, rowGroupReader, columnChunkMetaData, columnIndex);
-                    default:
-                        throw new NotSupportedException($"Physical type {type} is not supported");
-                }
-            }
+            var type = columnChunkMetaData.Type;
 
-            catch
+            switch (type)
             {
-                parquetHandle.Dispose();
-                throw;
+                case PhysicalType.Boolean:
+                    return new ColumnReader<bool>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.Int32:
+                    return new ColumnReader<int>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.Int64:
+                    return new ColumnReader<long>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.Int96:
+                    return new ColumnReader<Int96>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.Float:
+                    return new ColumnReader<float>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.Double:
+                    return new ColumnReader<double>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.ByteArray:
+                    return new ColumnReader<ByteArray>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                case PhysicalType.FixedLenByteArray:
+                    return new ColumnReader<FixedLenByteArray>(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection);
+                default:
+                    throw new NotSupportedException($"Physical type {type} is not supported");
             }
         }
 
-        internal ColumnReader(ParquetHandle handle, RowGroupReader rowGroupReader, ColumnChunkMetaData columnChunkMetaData, int columnIndex)
+        internal ColumnReader(Func<IntPtr> createHandle, RowGroupReader rowGroupReader, ColumnChunkMetaData columnChunkMetaData, int columnIndex, RowRangeSelection? rowRangeSelection)
         {
-            Handle = handle;
+            _createHandle = createHandle;
             RowGroupReader = rowGroupReader;
             ColumnChunkMetaData = columnChunkMetaData;
             ColumnIndex = columnIndex;
+            RowRangeSelection = rowRangeSelection;
         }
 
         public void Dispose()
         {
             ColumnChunkMetaData.Dispose();
-            Handle.Dispose();
+            _handle?.Dispose();
+            _disposed = true;
         }
 
         public int ColumnIndex { get; }
         public LogicalTypeFactory LogicalTypeFactory => RowGroupReader.ParquetFileReader.LogicalTypeFactory;
         public LogicalReadConverterFactory LogicalReadConverterFactory => RowGroupReader.ParquetFileReader.LogicalReadConverterFactory;
 
-        public ColumnDescriptor ColumnDescriptor => new(ExceptionInfo.Return<IntPtr>(Handle, ColumnReader_Descr));
+        public ColumnDescriptor ColumnDescriptor => RowGroupReader.MetaData.Schema.Column(ColumnIndex);
         public bool HasNext => ExceptionInfo.Return<bool>(Handle, ColumnReader_HasNext);
-        public PhysicalType Type => ExceptionInfo.Return<PhysicalType>(Handle, ColumnReader_Type);
+        public PhysicalType Type => ColumnChunkMetaData.Type;
+
+        /// <summary>
+        /// The rows that logical readers created from this column reader return,
+        /// or null if this reader reads all rows in the row group.
+        /// </summary>
+        public IReadOnlyList<RowRange>? RowRanges => RowRangeSelection?.Ranges;
+
+        /// <summary>
+        /// The rows covered by the data pages this column reader reads,
+        /// or null if this reader reads all rows in the row group.
+        /// </summary>
+        public IReadOnlyList<RowRange>? PageRowRanges => RowRangeSelection?.PageRanges;
 
         public abstract Type ElementType { get; }
         public abstract TReturn Apply<TReturn>(IColumnReaderVisitor<TReturn> visitor);
@@ -78,6 +86,8 @@ namespace ParquetSharp
         /// <returns>the number of physical rows skipped</returns>
         public abstract long Skip(long numRowsToSkip);
 
+        internal abstract unsafe long ReadBatchSpaced(long batchSize, void* values, ulong* validBits, out long nullCount);
+
 #pragma warning disable RS0026
 
         public LogicalColumnReader LogicalReader(int bufferLength = 4 * 1024)
@@ -112,15 +122,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern void ColumnReader_Free(IntPtr columnReader);
 
-        [DllImport(ParquetDll.Name)]
-        private static extern IntPtr ColumnReader_Descr(IntPtr columnReader, out IntPtr columnDescriptor);
-
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr ColumnReader_HasNext(IntPtr columnReader, [MarshalAs(UnmanagedType.I1)] out bool hasNext);
 
-        [DllImport(ParquetDll.Name)]
-        private static extern IntPtr ColumnReader_Type(IntPtr columnReader, out PhysicalType type);
-
         /// <exclude />
         [DllImport(ParquetDll.Name)]
         protected static extern unsafe IntPtr TypedColumnReader_ReadBatch_Bool(
@@ -168,6 +172,84 @@ namespace ParquetSharp
         protected static extern unsafe IntPtr TypedColumnReader_ReadBatch_FixedLenByteArray(
             IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, FixedLenByteArray* values, out long valuesRead, out long levelsRead);
 
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_Bool(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out bool* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_Int32(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out int* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_Int64(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out long* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_Int96(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out Int96* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_Float(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out float* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_Double(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out double* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_ByteArray(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out ByteArray* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchWithDictionary_FixedLenByteArray(
+            IntPtr columnReader, long batchSize, short* defLevels, short* repLevels, int* indices,
+            out long indicesRead, out FixedLenByteArray* dictionary, out int dictionaryLength, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchSpaced_Bool(
+            IntPtr columnReader, long batchSize, bool* values, byte* validBits, out long nullCount, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchSpaced_Int32(
+            IntPtr columnReader, long batchSize, int* values, byte* validBits, out long nullCount, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchSpaced_Int64(
+            IntPtr columnReader, long batchSize, long* values, byte* validBits, out long nullCount, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchSpaced_Int96(
+            IntPtr columnReader, long batchSize, Int96* values, byte* validBits, out long nullCount, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchSpaced_Float(
+            IntPtr columnReader, long batchSize, float* values, byte* validBits, out long nullCount, out long levelsRead);
+
+        /// <exclude />
+        [DllImport(ParquetDll.Name)]
+        protected static extern unsafe IntPtr TypedColumnReader_ReadBatchSpaced_Double(
+            IntPtr columnReader, long batchSize, double* values, byte* validBits, out long nullCount, out long levelsRead);
+
         /// <exclude />
         [DllImport(ParquetDll.Name)]
         protected static extern IntPtr TypedColumnReader_Skip_Bool(IntPtr columnReader, long numRowsToSkip, out long levelsSkipped);
@@ -200,16 +282,41 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         protected static extern IntPtr TypedColumnReader_Skip_FixedLenByteArray(IntPtr columnReader, long numRowsToSkip, out long levelsSkipped);
 
-        internal readonly ParquetHandle Handle;
+        /// <summary>
+        /// The native column reader, which is created when first accessed.
+        /// Creating it reads the column chunk's pages, or with buffered streams, starts reading them.
+        /// </summary>
+        internal ParquetHandle Handle
+        {
+            get
+            {
+                if (_handle == null)
+                {
+                    if (_disposed) throw new ObjectDisposedException(nameof(ColumnReader));
+                    _handle = new ParquetHandle(_createHandle(), ColumnReader_Free);
+                }
+                return _handle;
+            }
+        }
+
+        /// <summary>
+        /// Whether the native column reader has been created, in which case it may have read values.
+        /// </summary>
+        internal bool IsHandleCreated => _handle != null;
+
+        private readonly Func<IntPtr> _createHandle;
+        private ParquetHandle? _handle;
+        private bool _disposed;
         internal readonly RowGroupReader RowGroupReader;
         internal readonly ColumnChunkMetaData ColumnChunkMetaData;
+        internal readonly RowRangeSelection? RowRangeSelection;
     }
 
     /// <inheritdoc />
     public sealed class ColumnReader<TValue> : ColumnReader where TValue : unmanaged
     {
-        internal ColumnReader(ParquetHandle handle, RowGroupReader rowGroupReader, ColumnChunkMetaData columnChunkMetaData, int columnIndex)
-            : base(handle, rowGroupReader, columnChunkMetaData, columnIndex)
+        internal ColumnReader(Func<IntPtr> createHandle, RowGroupReader rowGroupReader, ColumnChunkMetaData columnChunkMetaData, int columnIndex, RowRangeSelection? rowRangeSelection)
+            : base(createHandle, rowGroupReader, columnChunkMetaData, columnIndex, rowRangeSelection)
         {
         }
 
@@ -305,6 +412,198 @@ namespace ParquetSharp
             }
         }
 
+        /// <summary>
+        /// Read a batch of dictionary indices rather than values, along with the column chunk dictionary the indices refer to.
+        /// This avoids materialising a value per row, but only works when all data pages are dictionary encoded
+        /// (see <see cref="ParquetSharp.ColumnChunkMetaData.IsFullyDictionaryEncoded"/>), otherwise a <see cref="ParquetException"/> is thrown.
+        /// </summary>
+        /// <remarks>
+        /// The dictionary is owned by the native column reader and is only valid until this reader is disposed.
+        /// For <see cref="ByteArray"/> and <see cref="FixedLenByteArray"/> values, the dictionary entries point into this native memory.
+        /// </remarks>
+        /// <param name="batchSize">The maximum number of levels to read</param>
+        /// <param name="defLevels">Buffer for the definition levels, may be empty if the column has no definition levels</param>
+        /// <param name="repLevels">Buffer for the repetition levels, may be empty if the column has no repetition levels</param>
+        /// <param name="indices">Buffer for the dictionary indices of the non-null values</param>
+        /// <param name="indicesRead">The number of indices read</param>
+        /// <param name="dictionary">The dictionary, or an empty span if there was no more data to read</param>
+        /// <returns>The number of levels read</returns>
+        public unsafe long ReadBatchWithDictionary(long batchSize, Span<short> defLevels, Span<short> repLevels, Span<int> indices, out long indicesRead, out ReadOnlySpan<TValue> dictionary)
+        {
+            if (indices.Length < batchSize) throw new ArgumentOutOfRangeException(nameof(indices), "batchSize is larger than length of indices");
+            if (!defLevels.IsEmpty && defLevels.Length < batchSize) throw new ArgumentOutOfRangeException(nameof(defLevels), "batchSize is larger than length of defLevels");
+            if (!repLevels.IsEmpty && repLevels.Length < batchSize) throw new ArgumentOutOfRangeException(nameof(repLevels), "batchSize is larger than length of repLevels");
+
+            var type = typeof(TValue);
+
+            fixed (short* pDefLevels = defLevels)
+            fixed (short* pRepLevels = repLevels)
+            fixed (int* pIndices = indices)
+            {
+                if (type == typeof(bool))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_Bool(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(int))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_Int32(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(long))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_Int64(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(Int96))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_Int96(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(float))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_Float(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(double))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_Double(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(ByteArray))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_ByteArray(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                if (type == typeof(FixedLenByteArray))
+                {
+                    ExceptionInfo.Check(TypedColumnReader_ReadBatchWithDictionary_FixedLenByteArray(Handle.IntPtr,
+                        batchSize, pDefLevels, pRepLevels, pIndices, out indicesRead, out var pDictionary, out var dictionaryLength, out var levelsRead));
+                    GC.KeepAlive(Handle);
+                    dictionary = new ReadOnlySpan<TValue>(pDictionary, dictionaryLength);
+                    return levelsRead;
+                }
+
+                throw new NotSupportedException($"type {type} is not supported");
+            }
+        }
+
+        /// <summary>
+        /// Read a batch of values from a column without repetition levels, leaving space for null values so that
+        /// values[i] corresponds to row i, and setting bit i of the validity bitmap if row i is not null.
+        /// This avoids having to read and process definition levels for optional columns.
+        /// </summary>
+        /// <remarks>
+        /// The validity bitmap uses the same layout as Arrow, where row i corresponds to bit (i % 64) of validBits[i / 64].
+        /// Null values are set to the default value.
+        /// Reads continue across data pages, so only fixed width physical types are supported,
+        /// as <see cref="ByteArray"/> and <see cref="FixedLenByteArray"/> values point into page buffers
+        /// that are released when the next page is read.
+        /// </remarks>
+        /// <param name="batchSize">The maximum number of rows to read</param>
+        /// <param name="values">Buffer for the values</param>
+        /// <param name="validBits">Buffer for the validity bitmap, which must have at least one bit per row to read</param>
+        /// <param name="nullCount">The number of null values read</param>
+        /// <returns>The number of rows read</returns>
+        public unsafe long ReadBatchSpaced(long batchSize, Span<TValue> values, Span<ulong> validBits, out long nullCount)
+        {
+            if (typeof(TValue) == typeof(ByteArray) || typeof(TValue) == typeof(FixedLenByteArray))
+            {
+                throw new NotSupportedException("spaced reads are only supported for fixed width physical types");
+            }
+            if (values.Length < batchSize) throw new ArgumentOutOfRangeException(nameof(values), "batchSize is larger than length of values");
+            if (validBits.Length < (batchSize + 63) / 64) throw new ArgumentOutOfRangeException(nameof(validBits), "batchSize is larger than the number of bits in validBits");
+
+            fixed (TValue* pValues = values)
+            fixed (ulong* pValidBits = validBits)
+            {
+                return ReadBatchSpaced(batchSize, pValues, pValidBits, out nullCount);
+            }
+        }
+
+        internal override unsafe long ReadBatchSpaced(long batchSize, void* values, ulong* validBits, out long nullCount)
+        {
+            var type = typeof(TValue);
+
+            if (type == typeof(bool))
+            {
+                ExceptionInfo.Check(TypedColumnReader_ReadBatchSpaced_Bool(Handle.IntPtr,
+                    batchSize, (bool*) values, (byte*) validBits, out nullCount, out var levelsRead));
+                GC.KeepAlive(Handle);
+                return levelsRead;
+            }
+
+            if (type == typeof(int))
+            {
+                ExceptionInfo.Check(TypedColumnReader_ReadBatchSpaced_Int32(Handle.IntPtr,
+                    batchSize, (int*) values, (byte*) validBits, out nullCount, out var levelsRead));
+                GC.KeepAlive(Handle);
+                return levelsRead;
+            }
+
+            if (type == typeof(long))
+            {
+                ExceptionInfo.Check(TypedColumnReader_ReadBatchSpaced_Int64(Handle.IntPtr,
+                    batchSize, (long*) values, (byte*) validBits, out nullCount, out var levelsRead));
+                GC.KeepAlive(Handle);
+                return levelsRead;
+            }
+
+            if (type == typeof(Int96))
+            {
+                ExceptionInfo.Check(TypedColumnReader_ReadBatchSpaced_Int96(Handle.IntPtr,
+                    batchSize, (Int96*) values, (byte*) validBits, out nullCount, out var levelsRead));
+                GC.KeepAlive(Handle);
+                return levelsRead;
+            }
+
+            if (type == typeof(float))
+            {
+                ExceptionInfo.Check(TypedColumnReader_ReadBatchSpaced_Float(Handle.IntPtr,
+                    batchSize, (float*) values, (byte*) validBits, out nullCount, out var levelsRead));
+                GC.KeepAlive(Handle);
+                return levelsRead;
+            }
+
+            if (type == typeof(double))
+            {
+                ExceptionInfo.Check(TypedColumnReader_ReadBatchSpaced_Double(Handle.IntPtr,
+                    batchSize, (double*) values, (byte*) validBits, out nullCount, out var levelsRead));
+                GC.KeepAlive(Handle);
+                return levelsRead;
+            }
+
+            throw new NotSupportedException($"type {type} is not supported");
+        }
+
         public override long Skip(long numRowsToSkip)
         {
             var type = typeof(TValue);
@@ -83,6 +83,37 @@ namespace ParquetSharp
             return other != null && ExceptionInfo.Return<bool>(_handle, other._handle, FileMetaData_Equals);
         }
 
+        /// <summary>
+        /// Create another handle to the same native metadata, which can be disposed independently of this one.
+        /// </summary>
+        internal FileMetaData Share() => new(ExceptionInfo.Return<IntPtr>(_handle, FileMetaData_Share));
+
+        /// <summary>
+        /// Whether the file is encrypted, in which case the metadata can't be used to open the file again,
+        /// as it doesn't include the decryption state needed to read the column data.
+        /// </summary>
+        internal bool IsEncrypted => ExceptionInfo.Return<bool>(_handle, FileMetaData_Is_Encrypted);
+
+        /// <summary>
+        /// Get the total compressed size of the specified column chunks of each of the specified row groups.
+        /// </summary>
+        internal unsafe long[] GetTotalCompressedSizes(int[] rowGroups, int[] columns)
+        {
+            var sizes = new long[rowGroups.Length];
+
+            fixed (int* pRowGroups = rowGroups)
+            fixed (int* pColumns = columns)
+            fixed (long* pSizes = sizes)
+            {
+                ExceptionInfo.Check(FileMetaData_Total_Compressed_Sizes(_handle.IntPtr, pRowGroups, rowGroups.Length, pColumns, columns.Length, pSizes));
+            }
+
+            GC.KeepAlive(_handle);
+            return sizes;
+        }
+
+        internal INativeHandle Handle => _handle;
+
         [DllImport(ParquetDll.Name)]
         private static extern void FileMetaData_Free(IntPtr fileMetaData);
 
@@ -92,6 +123,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileMetaData_Equals(IntPtr fileMetaData, IntPtr other, [MarshalAs(UnmanagedType.I1)] out bool equals);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr FileMetaData_Is_Encrypted(IntPtr fileMetaData, [MarshalAs(UnmanagedType.I1)] out bool isEncrypted);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileMetaData_Key_Value_Metadata(IntPtr fileMetaData, out IntPtr keyValueMetadata);
 
@@ -110,9 +144,16 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileMetaData_Schema(IntPtr fileMetaData, out IntPtr schema);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr FileMetaData_Share(IntPtr fileMetaData, out IntPtr shared);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileMetaData_Size(IntPtr fileMetaData, out int size);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr FileMetaData_Total_Compressed_Sizes(
+            IntPtr fileMetaData, int* rowGroups, int numRowGroups, int* columns, int numColumns, long* sizes);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr FileMetaData_Version(IntPtr fileMetaData, out CppParquetVersion version);
 
@@ -0,0 +1,261 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using ParquetSharp.IO;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// A size-bounded, least recently used cache of parsed file metadata (footers),
+    /// so that files that are opened repeatedly don't need their footer to be read and parsed each time.
+    /// </summary>
+    /// <remarks>
+    /// Entries are keyed by the identity of a file together with its size and last modification time,
+    /// so the footer of a file is read again after it has been modified.
+    /// The size of an entry is the serialized size of its footer (<see cref="ParquetSharp.FileMetaData.Size"/>).
+    /// The parsed metadata is larger than this, but grows proportionally with it.
+    /// Files opened with <see cref="ParquetSharp.ReaderProperties.FileDecryptionProperties"/> set, and encrypted files,
+    /// are always opened by reading their footer and are never cached,
+    /// as the state needed to decrypt column data is set up when the footer is read
+    /// and the cache key doesn't include the decryption keys.
+    /// This class is thread-safe.
+    /// </remarks>
+    public sealed class FileMetaDataCache : IDisposable
+    {
+        /// <summary>
+        /// Create a new cache holding up to the specified total footer size.
+        /// </summary>
+        /// <param name="capacityBytes">The maximum total serialized size of cached footers</param>
+        public FileMetaDataCache(long capacityBytes)
+        {
+            if (capacityBytes < 0) throw new ArgumentOutOfRangeException(nameof(capacityBytes), "capacityBytes must not be negative");
+
+            CapacityBytes = capacityBytes;
+        }
+
+        /// <summary>
+        /// A process-wide cache, with a capacity of 64 MiB.
+        /// </summary>
+        public static FileMetaDataCache Shared { get; } = new(64 * 1024 * 1024);
+
+        /// <summary>
+        /// The maximum total serialized size of cached footers.
+        /// </summary>
+        public long CapacityBytes { get; }
+
+        /// <summary>
+        /// The total serialized size of the currently cached footers.
+        /// </summary>
+        public long SizeBytes
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _sizeBytes;
+                }
+            }
+        }
+
+        /// <summary>
+        /// The number of currently cached footers.
+        /// </summary>
+        public int Count
+        {
+            get
+            {
+                lock (_lock)
+                {
+                    return _entries.Count;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Open a file at the specified path, using its cached metadata if the file hasn't changed since it was cached.
+        /// </summary>
+        /// <param name="path">Path to the Parquet file</param>
+        /// <param name="readerProperties">A <see cref="ReaderProperties"/> object that configures the reader</param>
+        /// <param name="memoryMap">Whether to memory map the file rather than reading it</param>
+        /// <returns>A reader for the file</returns>
+        public ParquetFileReader OpenFile(string path, ReaderProperties? readerProperties = null, bool memoryMap = false)
+        {
+            if (path == null) throw new ArgumentNullException(nameof(path));
+
+            var fileInfo = new FileInfo(path);
+            if (!fileInfo.Exists)
+            {
+                // Let the reader report the error
+                return new ParquetFileReader(path, readerProperties, memoryMap);
+            }
+
+            if (HasDecryptionProperties(readerProperties))
+            {
+                return new ParquetFileReader(path, readerProperties, memoryMap);
+            }
+
+            var key = new Key(fileInfo.FullName, fileInfo.Length, fileInfo.LastWriteTimeUtc);
+            return Open(key, fileMetaData => new ParquetFileReader(path, readerProperties, memoryMap, fileMetaData));
+        }
+
+        /// <summary>
+        /// Open a <see cref="RandomAccessFile"/>, using the cached metadata for the file with the same identity,
+        /// size and last modification time if there is one.
+        /// </summary>
+        /// <param name="randomAccessFile">The file to read</param>
+        /// <param name="identity">A string that uniquely identifies the file, such as an object store URI</param>
+        /// <param name="fileSize">The size of the file in bytes</param>
+        /// <param name="lastModified">The time the file was last modified</param>
+        /// <param name="readerProperties">The <see cref="ReaderProperties"/> to use</param>
+        /// <returns>A reader for the file</returns>
+        public ParquetFileReader Open(RandomAccessFile randomAccessFile, string identity, long fileSize, DateTime lastModified, ReaderProperties? readerProperties = null)
+        {
+            if (randomAccessFile == null) throw new ArgumentNullException(nameof(randomAccessFile));
+            if (identity == null) throw new ArgumentNullException(nameof(identity));
+
+            if (HasDecryptionProperties(readerProperties))
+            {
+                return new ParquetFileReader(randomAccessFile, readerProperties);
+            }
+
+            var key = new Key(identity, fileSize, lastModified.ToUniversalTime());
+            return Open(key, fileMetaData => new ParquetFileReader(randomAccessFile, readerProperties, fileMetaData));
+        }
+
+        /// <summary>
+        /// Remove all cached metadata.
+        /// </summary>
+        public void Clear()
+        {
+            lock (_lock)
+            {
+                foreach (var entry in _lru)
+                {
+                    entry.FileMetaData.Dispose();
+                }
+                _lru.Clear();
+                _entries.Clear();
+                _sizeBytes = 0;
+            }
+        }
+
+        public void Dispose()
+        {
+            Clear();
+        }
+
+        private ParquetFileReader Open(Key key, Func<FileMetaData?, ParquetFileReader> open)
+        {
+            using (var cached = TryGet(key))
+            {
+                if (cached != null)
+                {
+                    return open(cached);
+                }
+            }
+
+            var reader = open(null);
+            try
+            {
+                var fileMetaData = reader.FileMetaData;
+                if (!fileMetaData.IsEncrypted)
+                {
+                    Add(key, fileMetaData.Share(), fileMetaData.Size);
+                }
+            }
+            catch
+            {
+                reader.Dispose();
+                throw;
+            }
+            return reader;
+        }
+
+        private static bool HasDecryptionProperties(ReaderProperties? readerProperties)
+        {
+            using var decryptionProperties = readerProperties?.FileDecryptionProperties;
+            return decryptionProperties != null;
+        }
+
+        /// <summary>
+        /// Get a new handle to the cached metadata, which remains valid if the entry is evicted.
+        /// </summary>
+        private FileMetaData? TryGet(Key key)
+        {
+            lock (_lock)
+            {
+                if (!_entries.TryGetValue(key, out var node))
+                {
+                    return null;
+                }
+
+                _lru.Remove(node);
+                _lru.AddFirst(node);
+                return node.Value.FileMetaData.Share();
+            }
+        }
+
+        private void Add(Key key, FileMetaData fileMetaData, long size)
+        {
+            lock (_lock)
+            {
+                if (size > CapacityBytes || _entries.ContainsKey(key))
+                {
+                    fileMetaData.Dispose();
+                    return;
+                }
+
+                while (_sizeBytes + size > CapacityBytes)
+                {
+                    var last = _lru.Last!;
+                    _lru.RemoveLast();
+                    _entries.Remove(last.Value.Key);
+                    _sizeBytes -= last.Value.Size;
+                    last.Value.FileMetaData.Dispose();
+                }
+
+                _entries.Add(key, _lru.AddFirst(new Entry(key, fileMetaData, size)));
+                _sizeBytes += size;
+            }
+        }
+
+        private readonly struct Key : IEquatable<Key>
+        {
+            public Key(string identity, long fileSize, DateTime lastModified)
+            {
+                Identity = identity;
+                FileSize = fileSize;
+                LastModified = lastModified;
+            }
+
+            public bool Equals(Key other) => Identity == other.Identity && FileSize == other.FileSize && LastModified == other.LastModified;
+
+            public override bool Equals(object? obj) => obj is Key other && Equals(other);
+
+            public override int GetHashCode() => (Identity, FileSize, LastModified).GetHashCode();
+
+            public readonly string Identity;
+            public readonly long FileSize;
+            public readonly DateTime LastModified;
+        }
+
+        private sealed class Entry
+        {
+            public Entry(Key key, FileMetaData fileMetaData, long size)
+            {
+                Key = key;
+                FileMetaData = fileMetaData;
+                Size = size;
+            }
+
+            public readonly Key Key;
+            public readonly FileMetaData FileMetaData;
+            public readonly long Size;
+        }
+
+        private readonly object _lock = new();
+        private readonly Dictionary<Key, LinkedListNode<Entry>> _entries = new();
+        private readonly LinkedList<Entry> _lru = new();
+        private long _sizeBytes;
+    }
+}
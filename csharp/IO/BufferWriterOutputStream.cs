@@ -0,0 +1,150 @@
+﻿using System;
+using System.Buffers;
+using System.IO;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp.IO
+{
+    /// <summary>
+    /// An output stream that writes directly into memory obtained from an <see cref="IBufferWriter{T}"/>,
+    /// such as an <c>ArrayBufferWriter&lt;byte&gt;</c> or a System.IO.Pipelines <c>PipeWriter</c>.
+    /// </summary>
+    /// <remarks>
+    /// Data written by the Parquet writer is copied once, into the spans returned by <see cref="IBufferWriter{T}.GetSpan"/>,
+    /// rather than being accumulated in a native buffer that must then be copied out.
+    /// Written data is committed with <see cref="IBufferWriter{T}.Advance"/> but never flushed,
+    /// so when writing to a PipeWriter, the consumer is responsible for flushing the pipe, for example after the file is closed.
+    /// The buffer writer must not be used by anything else while the file is being written.
+    /// </remarks>
+    public sealed class BufferWriterOutputStream : OutputStream
+    {
+        /// <summary>
+        /// Create a new output stream that writes to a buffer writer.
+        /// </summary>
+        /// <param name="bufferWriter">The buffer writer to write to</param>
+        public BufferWriterOutputStream(IBufferWriter<byte> bufferWriter)
+        {
+            _bufferWriter = bufferWriter ?? throw new ArgumentNullException(nameof(bufferWriter));
+            _write = Write;
+            _tell = Tell;
+            _flush = Flush;
+            _close = Close;
+            _closed = Closed;
+
+            Handle = Create(_write, _tell, _flush, _close, _closed, this);
+        }
+
+        /// <summary>
+        /// The number of bytes written to the buffer writer.
+        /// </summary>
+        public long Position => _position;
+
+        private static ParquetHandle Create(
+            ManagedOutputStream.WriteDelegate write,
+            ManagedOutputStream.TellDelegate tell,
+            ManagedOutputStream.FlushDelegate flush,
+            ManagedOutputStream.CloseDelegate close,
+            ManagedOutputStream.ClosedDelegate closed,
+            BufferWriterOutputStream outputStream)
+        {
+            ExceptionInfo.Check(ManagedOutputStream.ManagedOutputStream_Create(write, tell, flush, close, closed, out var handle));
+
+            void Free(IntPtr ptr)
+            {
+                OutputStream_Free(ptr);
+                // Keep the delegates alive until the C++ output stream has been freed, see ManagedOutputStream.Create
+                GC.KeepAlive(outputStream);
+            }
+
+            return new ParquetHandle(handle, Free);
+        }
+
+        private unsafe byte Write(IntPtr src, long nbytes, out string? exception)
+        {
+            try
+            {
+                while (nbytes > 0)
+                {
+                    var destination = _bufferWriter.GetSpan((int) Math.Min(nbytes, MaxSizeHint));
+                    var count = (int) Math.Min(nbytes, destination.Length);
+                    new ReadOnlySpan<byte>(src.ToPointer(), count).CopyTo(destination);
+                    _bufferWriter.Advance(count);
+
+                    _position += count;
+                    nbytes -= count;
+                    src = IntPtr.Add(src, count);
+                }
+
+                exception = _exceptionMessage = null;
+                return 0;
+            }
+            catch (Exception error)
+            {
+                return HandleException(error, out exception);
+            }
+        }
+
+        private byte Tell(IntPtr position, out string? exception)
+        {
+            Marshal.WriteInt64(position, _position);
+            exception = null;
+            return 0;
+        }
+
+        private static byte Flush(out string? exception)
+        {
+            exception = null;
+            return 0;
+        }
+
+        private byte Close(out string? exception)
+        {
+            _isClosed = true;
+            exception = null;
+            return 0;
+        }
+
+        private bool Closed()
+        {
+            return _isClosed;
+        }
+
+        private byte HandleException(Exception error, out string? exception)
+        {
+            if (error is OutOfMemoryException)
+            {
+                exception = _exceptionMessage = null;
+                return 1;
+            }
+            if (error is IOException)
+            {
+                exception = _exceptionMessage = error.ToString();
+                return 5;
+            }
+
+            exception = _exceptionMessage = error.ToString();
+            return 9;
+        }
+
+        private readonly IBufferWriter<byte> _bufferWriter;
+        private long _position;
+        private bool _isClosed;
+
+        // The lifetime of the delegates must match the lifetime of this class.
+        // ReSharper disable PrivateFieldCanBeConvertedToLocalVariable
+        private readonly ManagedOutputStream.WriteDelegate _write;
+        private readonly ManagedOutputStream.TellDelegate _tell;
+        private readonly ManagedOutputStream.FlushDelegate _flush;
+        private readonly ManagedOutputStream.CloseDelegate _close;
+        private readonly ManagedOutputStream.ClosedDelegate _closed;
+        // ReSharper restore PrivateFieldCanBeConvertedToLocalVariable
+
+        // The lifetime of the exception message must match the lifetime of this class.
+        // ReSharper disable NotAccessedField.Local
+        private string? _exceptionMessage;
+        // ReSharper restore NotAccessedField.Local
+
+        // Limit the size requested from the buffer writer for large writes, which are split across multiple spans
+        private const int MaxSizeHint = 1024 * 1024;
+    }
+}
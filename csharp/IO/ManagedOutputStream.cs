@@ -1,6 +1,9 @@
 ﻿using System;
+using System.Collections.Concurrent;
 using System.IO;
 using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
 
 namespace ParquetSharp.IO
 {
@@ -15,9 +18,38 @@ namespace ParquetSharp.IO
         }
 
         public ManagedOutputStream(Stream stream, bool leaveOpen)
+            : this(stream, leaveOpen, 0, 0)
         {
+        }
+
+        /// <summary>
+        /// Create a ManagedOutputStream that writes to the stream on a background task.
+        /// </summary>
+        /// <remarks>
+        /// Data written by the Parquet writer is copied into one of a bounded set of buffers,
+        /// and full buffers are written to the stream in order by a background task,
+        /// so that encoding can continue while a slow stream (e.g. a network upload) is being written to.
+        /// Writing only blocks when all buffers are waiting to be written.
+        /// Flushing or closing the output stream waits for all buffered data to be written,
+        /// and any error from writing to the stream is reported by the next write, flush or close.
+        /// The position of the stream is only read when it is created, so the stream doesn't need to support seeking.
+        /// </remarks>
+        /// <param name="stream">The stream to write to</param>
+        /// <param name="leaveOpen">Whether to keep the stream open after the output stream is closed</param>
+        /// <param name="bufferSize">The size of each buffer in bytes, or zero to write to the stream synchronously</param>
+        /// <param name="maxBuffers">The maximum number of buffers, including the one currently being filled</param>
+        /// <param name="useWriteAsync">Whether to write to the stream with <see cref="Stream.WriteAsync(byte[], int, int)"/> rather than <see cref="Stream.Write(byte[], int, int)"/></param>
+        public ManagedOutputStream(Stream stream, bool leaveOpen, int bufferSize, int maxBuffers, bool useWriteAsync = false)
+        {
+            if (bufferSize < 0) throw new ArgumentOutOfRangeException(nameof(bufferSize), "bufferSize must not be negative");
+            if (bufferSize > 0 && maxBuffers < 2) throw new ArgumentOutOfRangeException(nameof(maxBuffers), "maxBuffers must be at least 2 when writing in the background");
+
             _stream = stream;
             _leaveOpen = leaveOpen;
+            if (bufferSize > 0)
+            {
+                _backgroundWriter = new BackgroundWriter(stream, bufferSize, maxBuffers, useWriteAsync);
+            }
             _write = Write;
             _tell = Tell;
             _flush = Flush;
@@ -54,6 +86,13 @@ namespace ParquetSharp.IO
         {
             try
             {
+                if (_backgroundWriter != null)
+                {
+                    _backgroundWriter.Write(src, nbytes);
+                    exception = _exceptionMessage = null;
+                    return 0;
+                }
+
 #if !NETSTANDARD2_1_OR_GREATER
                 var buffer = new byte[(int) Math.Min(nbytes, MaxArraySize)];
 #endif
@@ -89,7 +128,7 @@ namespace ParquetSharp.IO
         {
             try
             {
-                Marshal.WriteInt64(position, _stream.Position);
+                Marshal.WriteInt64(position, _backgroundWriter?.Position ?? _stream.Position);
                 exception = _exceptionMessage = null;
                 return 0;
             }
@@ -103,6 +142,7 @@ namespace ParquetSharp.IO
         {
             try
             {
+                _backgroundWriter?.WaitForWrites();
                 _stream.Flush();
                 exception = _exceptionMessage = null;
                 return 0;
@@ -117,9 +157,16 @@ namespace ParquetSharp.IO
         {
             try
             {
-                if (!_leaveOpen)
+                try
                 {
-                    _stream.Close();
+                    _backgroundWriter?.Close();
+                }
+                finally
+                {
+                    if (!_leaveOpen)
+                    {
+                        _stream.Close();
+                    }
                 }
 
                 exception = null;
@@ -160,8 +207,127 @@ namespace ParquetSharp.IO
             return 9;
         }
 
+        /// <summary>
+        /// Copies written data into a bounded set of buffers that are written to the stream in order on a background task.
+        /// Methods other than the background writes are only called by one thread at a time.
+        /// </summary>
+        private sealed class BackgroundWriter
+        {
+            public BackgroundWriter(Stream stream, int bufferSize, int maxBuffers, bool useWriteAsync)
+            {
+                _stream = stream;
+                _bufferSize = bufferSize;
+                _useWriteAsync = useWriteAsync;
+                _freeBuffers = new SemaphoreSlim(maxBuffers, maxBuffers);
+                Position = stream.CanSeek ? stream.Position : 0;
+            }
+
+            public long Position { get; private set; }
+
+            public void Write(IntPtr src, long nbytes)
+            {
+                ThrowIfWriteFailed();
+
+                while (nbytes > 0)
+                {
+                    if (_buffer == null)
+                    {
+                        // Blocks while all buffers are waiting to be written
+                        _freeBuffers.Wait();
+                        _buffer = _bufferPool.TryPop(out var buffer) ? buffer : new byte[_bufferSize];
+                    }
+
+                    var count = (int) Math.Min(nbytes, _buffer.Length - _bufferLength);
+                    Marshal.Copy(src, _buffer, _bufferLength, count);
+                    _bufferLength += count;
+                    Position += count;
+                    nbytes -= count;
+                    src = IntPtr.Add(src, count);
+
+                    if (_bufferLength == _buffer.Length)
+                    {
+                        SubmitBuffer();
+                    }
+                }
+            }
+
+            /// <summary>
+            /// Write any partially filled buffer and wait for all buffers to be written to the stream.
+            /// </summary>
+            public void WaitForWrites()
+            {
+                if (_buffer != null && _bufferLength > 0)
+                {
+                    SubmitBuffer();
+                }
+
+                _writes.GetAwaiter().GetResult();
+            }
+
+            public void Close()
+            {
+                if (_closed)
+                {
+                    return;
+                }
+
+                _closed = true;
+                WaitForWrites();
+            }
+
+            private void SubmitBuffer()
+            {
+                var buffer = _buffer!;
+                var length = _bufferLength;
+                var previous = _writes;
+                _buffer = null;
+                _bufferLength = 0;
+
+                _writes = Task.Run(async () =>
+                {
+                    try
+                    {
+                        // Once a write has failed, don't write any later data
+                        await previous.ConfigureAwait(false);
+
+                        if (_useWriteAsync)
+                        {
+                            await _stream.WriteAsync(buffer, 0, length).ConfigureAwait(false);
+                        }
+                        else
+                        {
+                            _stream.Write(buffer, 0, length);
+                        }
+                    }
+                    finally
+                    {
+                        _bufferPool.Push(buffer);
+                        _freeBuffers.Release();
+                    }
+                });
+            }
+
+            private void ThrowIfWriteFailed()
+            {
+                if (_writes.IsFaulted)
+                {
+                    _writes.GetAwaiter().GetResult();
+                }
+            }
+
+            private readonly Stream _stream;
+            private readonly int _bufferSize;
+            private readonly bool _useWriteAsync;
+            private readonly SemaphoreSlim _freeBuffers;
+            private readonly ConcurrentStack<byte[]> _bufferPool = new();
+            private Task _writes = Task.CompletedTask;
+            private byte[]? _buffer;
+            private int _bufferLength;
+            private bool _closed;
+        }
+
         [DllImport(ParquetDll.Name)]
-        private static extern IntPtr ManagedOutputStream_Create(
+        internal static extern IntPtr ManagedOutputStream_Create(
             WriteDelegate write,
             TellDelegate tell,
             FlushDelegate flush,
@@ -170,14 +336,15 @@ namespace ParquetSharp.IO
             out IntPtr outputStream);
 
 
-        private delegate byte WriteDelegate(IntPtr buffer, long nbyte, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
-        private delegate byte TellDelegate(IntPtr position, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
-        private delegate byte FlushDelegate([MarshalAs(UnmanagedType.LPStr)] out string? exception);
-        private delegate byte CloseDelegate([MarshalAs(UnmanagedType.LPStr)] out string? exception);
-        private delegate bool ClosedDelegate();
+        internal delegate byte WriteDelegate(IntPtr buffer, long nbyte, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
+        internal delegate byte TellDelegate(IntPtr position, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
+        internal delegate byte FlushDelegate([MarshalAs(UnmanagedType.LPStr)] out string? exception);
+        internal delegate byte CloseDelegate([MarshalAs(UnmanagedType.LPStr)] out string? exception);
+        internal delegate bool ClosedDelegate();
 
         private readonly Stream _stream;
         private readonly bool _leaveOpen;
+        private readonly BackgroundWriter? _backgroundWriter;
 
         // The lifetime of the delegates must match the lifetime of this class.
         // ReSharper disable PrivateFieldCanBeConvertedToLocalVariable
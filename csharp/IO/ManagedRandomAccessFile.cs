@@ -1,6 +1,11 @@
 ﻿using System;
 using System.IO;
 using System.Runtime.InteropServices;
+using System.Threading;
+using System.Threading.Tasks;
+#if NET6_0_OR_GREATER
+using Microsoft.Win32.SafeHandles;
+#endif
 
 namespace ParquetSharp.IO
 {
@@ -9,27 +14,175 @@ namespace ParquetSharp.IO
     /// </summary>
     public sealed class ManagedRandomAccessFile : RandomAccessFile
     {
+        /// <summary>
+        /// Reads bytes from an absolute position in a file, without depending on or modifying the position of a stream.
+        /// Positional readers may be called concurrently from multiple threads.
+        /// </summary>
+        /// <param name="position">The position in the file to start reading from</param>
+        /// <param name="buffer">The buffer to read into</param>
+        /// <returns>The number of bytes read, which is zero at the end of the file</returns>
+        public delegate int PositionalReader(long position, Span<byte> buffer);
+
+        /// <summary>
+        /// Asynchronously reads bytes from an absolute position in a file, without depending on or modifying the position of a stream.
+        /// Positional readers may be called concurrently, and many reads may be in flight at once.
+        /// </summary>
+        /// <param name="position">The position in the file to start reading from</param>
+        /// <param name="buffer">The buffer to read into</param>
+        /// <returns>The number of bytes read, which is zero at the end of the file</returns>
+        public delegate Task<int> AsyncPositionalReader(long position, Memory<byte> buffer);
+
         public ManagedRandomAccessFile(Stream stream)
             : this(stream, false)
         {
         }
 
         public ManagedRandomAccessFile(Stream stream, bool leaveOpen)
+            : this(stream, leaveOpen, null)
+        {
+        }
+
+        /// <summary>
+        /// Create a ManagedRandomAccessFile that uses a positional reader for random access reads.
+        /// </summary>
+        /// <remarks>
+        /// Arrow reads column chunks with random access reads, which can be issued concurrently
+        /// when using <see cref="ParquetSharp.Arrow.ArrowReaderProperties.UseThreads"/> or pre-buffering.
+        /// Without a positional reader these must seek and then read the stream while holding a lock,
+        /// so are serialized. The stream is still used for sequential reads and to get the file size.
+        /// </remarks>
+        /// <param name="stream">The stream to read from</param>
+        /// <param name="leaveOpen">Whether to keep the stream open after the file is closed</param>
+        /// <param name="readAt">Optional thread-safe reader used for random access reads</param>
+        public ManagedRandomAccessFile(Stream stream, bool leaveOpen, PositionalReader? readAt)
+            : this(stream, leaveOpen, readAt, null)
+        {
+        }
+
+        /// <summary>
+        /// Create a ManagedRandomAccessFile that uses positional readers for random access reads.
+        /// </summary>
+        /// <remarks>
+        /// Arrow uses asynchronous reads when pre-buffering column chunks and when reading record batches with a generator.
+        /// Without an asynchronous reader, each of these reads blocks an Arrow IO thread until it completes,
+        /// which limits the number of reads in flight to the size of the IO thread pool.
+        /// With an asynchronous reader, no thread is used while a read is in flight,
+        /// which allows many concurrent reads from high latency storage.
+        /// </remarks>
+        /// <param name="stream">The stream to read from</param>
+        /// <param name="leaveOpen">Whether to keep the stream open after the file is closed</param>
+        /// <param name="readAt">Optional thread-safe reader used for synchronous random access reads</param>
+        /// <param name="readAtAsync">Optional thread-safe reader used for asynchronous random access reads</param>
+        public ManagedRandomAccessFile(Stream stream, bool leaveOpen, PositionalReader? readAt, AsyncPositionalReader? readAtAsync)
         {
             _stream = stream;
             _leaveOpen = leaveOpen;
+            _positionalReader = readAt;
+            _asyncPositionalReader = readAtAsync;
             _read = Read;
+            _readAt = readAt == null ? null : ReadAt;
+            _readAsync = readAtAsync == null ? null : ReadAsync;
             _close = Close;
             _getSize = GetSize;
             _tell = Tell;
             _seek = Seek;
             _closed = Closed;
 
-            Handle = Create(_read, _close, _getSize, _tell, _seek, _closed, this);
+            Handle = Create(_read, _readAt, _readAsync, _close, _getSize, _tell, _seek, _closed, this);
+        }
+
+        /// <summary>
+        /// Create a ManagedRandomAccessFile that reads asynchronously from a seekable stream using <see cref="Stream.ReadAsync(byte[], int, int)"/>.
+        /// </summary>
+        /// <remarks>
+        /// Random access reads must seek and then read the stream, so are serialized,
+        /// but asynchronous reads wait for the previous read to complete without blocking a thread.
+        /// </remarks>
+        /// <param name="stream">The stream to read from</param>
+        /// <param name="leaveOpen">Whether to keep the stream open after the file is closed</param>
+        /// <returns>The created file</returns>
+        public static ManagedRandomAccessFile WithAsyncReads(Stream stream, bool leaveOpen = false)
+        {
+            if (stream == null) throw new ArgumentNullException(nameof(stream));
+
+            var streamLock = new SemaphoreSlim(1, 1);
+
+            int ReadAt(long position, Span<byte> buffer)
+            {
+                streamLock.Wait();
+                try
+                {
+                    stream.Position = position;
+#if (NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER)
+                    return stream.Read(buffer);
+#else
+                    var array = new byte[buffer.Length];
+                    var read = stream.Read(array, 0, array.Length);
+                    array.AsSpan(0, read).CopyTo(buffer);
+                    return read;
+#endif
+                }
+                finally
+                {
+                    streamLock.Release();
+                }
+            }
+
+            async Task<int> ReadAtAsync(long position, Memory<byte> buffer)
+            {
+                await streamLock.WaitAsync().ConfigureAwait(false);
+                try
+                {
+                    stream.Position = position;
+#if (NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER)
+                    return await stream.ReadAsync(buffer).ConfigureAwait(false);
+#else
+                    var array = new byte[buffer.Length];
+                    var read = await stream.ReadAsync(array, 0, array.Length).ConfigureAwait(false);
+                    array.AsMemory(0, read).CopyTo(buffer);
+                    return read;
+#endif
+                }
+                finally
+                {
+                    streamLock.Release();
+                }
+            }
+
+            return new ManagedRandomAccessFile(stream, leaveOpen, ReadAt, ReadAtAsync);
+        }
+
+#if NET6_0_OR_GREATER
+        /// <summary>
+        /// Create a ManagedRandomAccessFile that reads from a file handle.
+        /// Random access reads use <see cref="System.IO.RandomAccess"/> so can be performed concurrently and asynchronously.
+        /// </summary>
+        /// <param name="handle">A handle to a file opened for reading</param>
+        public ManagedRandomAccessFile(SafeFileHandle handle)
+            : this(handle, false)
+        {
         }
 
+        /// <summary>
+        /// Create a ManagedRandomAccessFile that reads from a file handle.
+        /// Random access reads use <see cref="System.IO.RandomAccess"/> so can be performed concurrently and asynchronously.
+        /// </summary>
+        /// <param name="handle">A handle to a file opened for reading</param>
+        /// <param name="leaveOpen">Whether to keep the handle open after the file is closed</param>
+        public ManagedRandomAccessFile(SafeFileHandle handle, bool leaveOpen)
+            : this(
+                new FileStream(handle, FileAccess.Read, bufferSize: 0),
+                leaveOpen,
+                (position, buffer) => RandomAccess.Read(handle, buffer, position),
+                (position, buffer) => RandomAccess.ReadAsync(handle, buffer, position).AsTask())
+        {
+        }
+#endif
+
         private static ParquetHandle Create(
             ReadDelegate read,
+            ReadAtDelegate? readAt,
+            ReadAsyncDelegate? readAsync,
             CloseDelegate close,
             GetSizeDelegate getSize,
             TellDelegate tell,
@@ -37,7 +190,7 @@ namespace ParquetSharp.IO
             ClosedDelegate closed,
             ManagedRandomAccessFile managedFile)
         {
-            ExceptionInfo.Check(ManagedRandomAccessFile_Create(read, close, getSize, tell, seek, closed, out var handle));
+            ExceptionInfo.Check(ManagedRandomAccessFile_Create(read, readAt, readAsync, close, getSize, tell, seek, closed, out var handle));
 
             void Free(IntPtr ptr)
             {
@@ -91,6 +244,72 @@ namespace ParquetSharp.IO
             }
         }
 
+        private byte ReadAt(long position, long nbytes, IntPtr bytesRead, IntPtr dest, out string? exception)
+        {
+            try
+            {
+                var totalRead = 0L;
+                while (totalRead < nbytes)
+                {
+                    var bytesToRead = (int) Math.Min(nbytes - totalRead, MaxArraySize);
+                    int read;
+                    unsafe
+                    {
+                        read = _positionalReader!(position + totalRead, new Span<byte>(dest.ToPointer(), bytesToRead));
+                    }
+                    if (read == 0)
+                    {
+                        break;
+                    }
+                    totalRead += read;
+                    dest = IntPtr.Add(dest, read);
+                }
+
+                Marshal.WriteInt64(bytesRead, totalRead);
+                exception = null;
+                return 0;
+            }
+            catch (Exception error)
+            {
+                return HandleException(error, out exception);
+            }
+        }
+
+        private byte ReadAsync(long position, long nbytes, IntPtr dest, IntPtr pendingRead, out string? exception)
+        {
+            // The read is completed by calling back into native code, so the task doesn't need to be observed
+            _ = CompleteReadAsync(position, nbytes, dest, pendingRead);
+            exception = null;
+            return 0;
+        }
+
+        private async Task CompleteReadAsync(long position, long nbytes, IntPtr dest, IntPtr pendingRead)
+        {
+            var totalRead = 0L;
+            try
+            {
+                while (totalRead < nbytes)
+                {
+                    var bytesToRead = (int) Math.Min(nbytes - totalRead, MaxArraySize);
+                    var memory = new UnmanagedMemoryManager(new IntPtr(dest.ToInt64() + totalRead), bytesToRead).Memory;
+                    var read = await _asyncPositionalReader!(position + totalRead, memory).ConfigureAwait(false);
+                    if (read == 0)
+                    {
+                        break;
+                    }
+                    totalRead += read;
+                }
+            }
+            catch (Exception error)
+            {
+                var statusCode = HandleException(error, out var exception);
+                ManagedRandomAccessFile_CompleteRead(pendingRead, 0, statusCode, exception);
+                return;
+            }
+
+            ManagedRandomAccessFile_CompleteRead(pendingRead, totalRead, 0, null);
+        }
+
         private byte Close(out string? exception)
         {
             try
@@ -183,6 +402,8 @@ namespace ParquetSharp.IO
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr ManagedRandomAccessFile_Create(
             ReadDelegate read,
+            ReadAtDelegate? readAt,
+            ReadAsyncDelegate? readAsync,
             CloseDelegate close,
             GetSizeDelegate getSize,
             TellDelegate tell,
@@ -190,7 +411,12 @@ namespace ParquetSharp.IO
             ClosedDelegate closed,
             out IntPtr randomAccessFile);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern void ManagedRandomAccessFile_CompleteRead(IntPtr pendingRead, long bytesRead, byte statusCode, [MarshalAs(UnmanagedType.LPStr)] string? exception);
+
         private delegate byte ReadDelegate(long nbyte, IntPtr bytesRead, IntPtr dest, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
+        private delegate byte ReadAtDelegate(long position, long nbyte, IntPtr bytesRead, IntPtr dest, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
+        private delegate byte ReadAsyncDelegate(long position, long nbyte, IntPtr dest, IntPtr pendingRead, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
         private delegate byte CloseDelegate([MarshalAs(UnmanagedType.LPStr)] out string? exception);
         private delegate byte GetSizeDelegate(IntPtr size, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
         private delegate byte TellDelegate(IntPtr position, [MarshalAs(UnmanagedType.LPStr)] out string? exception);
@@ -199,10 +425,14 @@ namespace ParquetSharp.IO
 
         private readonly Stream _stream;
         private readonly bool _leaveOpen;
+        private readonly PositionalReader? _positionalReader;
+        private readonly AsyncPositionalReader? _asyncPositionalReader;
 
         // The lifetime of the delegates must match the lifetime of this class.
         // ReSharper disable PrivateFieldCanBeConvertedToLocalVariable
         private readonly ReadDelegate _read;
+        private readonly ReadAtDelegate? _readAt;
+        private readonly ReadAsyncDelegate? _readAsync;
         private readonly CloseDelegate _close;
         private readonly GetSizeDelegate _getSize;
         private readonly TellDelegate _tell;
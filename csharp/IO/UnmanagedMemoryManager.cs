@@ -0,0 +1,37 @@
+using System;
+using System.Buffers;
+
+namespace ParquetSharp.IO
+{
+    /// <summary>
+    /// Exposes a block of native memory as <see cref="Memory{T}"/>, so it can be passed to asynchronous APIs.
+    /// The memory must remain valid for as long as the returned Memory is in use.
+    /// </summary>
+    internal sealed unsafe class UnmanagedMemoryManager : MemoryManager<byte>
+    {
+        public UnmanagedMemoryManager(IntPtr pointer, int length)
+        {
+            _pointer = (byte*) pointer.ToPointer();
+            _length = length;
+        }
+
+        public override Span<byte> GetSpan() => new(_pointer, _length);
+
+        public override MemoryHandle Pin(int elementIndex = 0)
+        {
+            if (elementIndex < 0 || elementIndex > _length) throw new ArgumentOutOfRangeException(nameof(elementIndex));
+            return new MemoryHandle(_pointer + elementIndex);
+        }
+
+        public override void Unpin()
+        {
+        }
+
+        protected override void Dispose(bool disposing)
+        {
+        }
+
+        private readonly byte* _pointer;
+        private readonly int _length;
+    }
+}
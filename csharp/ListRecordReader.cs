@@ -0,0 +1,81 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Reads whole records of a list column with a single level of repetition in bulk, using the Arrow record reader.
+    /// Definition and repetition levels are converted to list offsets natively.
+    /// </summary>
+    /// <remarks>
+    /// This reads the column chunk independently of any <see cref="ColumnReader"/> for the same column,
+    /// so is only used in place of a column reader that hasn't created its native reader.
+    /// </remarks>
+    internal sealed class ListRecordReader : IDisposable
+    {
+        public ListRecordReader(RowGroupReader rowGroupReader, int columnIndex)
+        {
+            _handle = new ParquetHandle(ExceptionInfo.Return<int, IntPtr>(rowGroupReader.Handle, columnIndex, ListRecordReader_Create), ListRecordReader_Free);
+            _rowGroupReader = rowGroupReader;
+        }
+
+        public void Dispose()
+        {
+            _handle.Dispose();
+        }
+
+        /// <summary>
+        /// Read up to numRecords records, replacing any previously read records.
+        /// </summary>
+        /// <param name="numRecords">The maximum number of records to read</param>
+        /// <param name="numValues">The number of non-null leaf values read</param>
+        /// <param name="numElements">The total number of list elements read, including null elements</param>
+        /// <returns>The number of records read</returns>
+        public long ReadRecords(long numRecords, out long numValues, out long numElements)
+        {
+            ExceptionInfo.Check(ListRecordReader_ReadRecords(_handle.IntPtr, numRecords, out var recordsRead, out numValues, out numElements));
+            GC.KeepAlive(_handle);
+            return recordsRead;
+        }
+
+        /// <summary>
+        /// Copy out the records read by the last call to <see cref="ReadRecords"/>.
+        /// </summary>
+        /// <param name="numRecords">The number of records read</param>
+        /// <param name="values">Buffer for the dense non-null leaf values</param>
+        /// <param name="elementDefLevels">Buffer for the definition level of each list element, or null if not required</param>
+        /// <param name="offsets">Buffer for the list offsets, with numRecords + 1 entries</param>
+        /// <param name="listValidBits">Buffer for the list validity bitmap</param>
+        /// <returns>The number of null lists</returns>
+        public unsafe long ReadLists(long numRecords, void* values, short* elementDefLevels, int* offsets, ulong* listValidBits)
+        {
+            ExceptionInfo.Check(ListRecordReader_ReadLists(_handle.IntPtr, numRecords, values, elementDefLevels, offsets, (byte*) listValidBits, out var listNullCount));
+            GC.KeepAlive(_handle);
+            return listNullCount;
+        }
+
+        public long SkipRecords(long numRecords)
+        {
+            return ExceptionInfo.Return<long, long>(_handle, numRecords, ListRecordReader_SkipRecords);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ListRecordReader_Create(IntPtr rowGroupReader, int columnIndex, out IntPtr listRecordReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void ListRecordReader_Free(IntPtr listRecordReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ListRecordReader_ReadRecords(IntPtr listRecordReader, long numRecords, out long recordsRead, out long numValues, out long numElements);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr ListRecordReader_ReadLists(
+            IntPtr listRecordReader, long numRecords, void* values, short* elementDefLevels, int* offsets, byte* listValidBits, out long listNullCount);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ListRecordReader_SkipRecords(IntPtr listRecordReader, long numRecords, out long recordsSkipped);
+
+        private readonly ParquetHandle _handle;
+        private readonly RowGroupReader _rowGroupReader; // Keep the row group and file reader alive
+    }
+}
@@ -0,0 +1,159 @@
+using System;
+
+namespace ParquetSharp.LogicalBatchReader
+{
+    /// <summary>
+    /// Reads string values from a fully dictionary encoded column by reading dictionary indices,
+    /// so that each dictionary entry is only decoded to a string once per column chunk.
+    /// This doesn't use a buffered reader so is only compatible with plain scalar columns.
+    /// </summary>
+    internal sealed class DictionaryStringReader : ILogicalBatchReader<string?>
+    {
+        public DictionaryStringReader(
+            ColumnReader<ByteArray> physicalReader,
+            LogicalStreamBuffers<ByteArray> buffers,
+            short definitionLevel)
+        {
+            _physicalReader = physicalReader;
+            _defLevels = buffers.DefLevels;
+            _indices = new int[buffers.Length];
+            _definitionLevel = definitionLevel;
+            IndexReader = new DictionaryIndexReader(this);
+        }
+
+        /// <summary>
+        /// Reads the dictionary indices rather than the string values, sharing the position of this reader.
+        /// Null values are read as -1.
+        /// </summary>
+        public ILogicalBatchReader<int> IndexReader { get; }
+
+        /// <summary>
+        /// Get the decoded dictionary for the column chunk, loading the first data page if nothing has been read yet.
+        /// </summary>
+        public string[] GetDictionary()
+        {
+            if (_strings == null)
+            {
+                if (!_physicalReader.HasNext)
+                {
+                    return Array.Empty<string>();
+                }
+
+                _physicalReader.ReadBatchWithDictionary(0, Span<short>.Empty, Span<short>.Empty, Span<int>.Empty, out _, out var dictionary);
+                GetDictionaryStrings(dictionary);
+            }
+
+            return _strings!;
+        }
+
+        public int ReadBatch(Span<string?> destination)
+        {
+            var totalRowsRead = 0;
+            while (totalRowsRead < destination.Length && _physicalReader.HasNext)
+            {
+                var rowsToRead = Math.Min(destination.Length - totalRowsRead, _indices.Length);
+                var levelsRead = checked((int) _physicalReader.ReadBatchWithDictionary(
+                    rowsToRead, _defLevels, Span<short>.Empty, _indices, out _, out var dictionary));
+                var strings = GetDictionaryStrings(dictionary);
+
+                var rows = destination.Slice(totalRowsRead, levelsRead);
+                for (int i = 0, src = 0; i < rows.Length; ++i)
+                {
+                    rows[i] = _defLevels == null || _defLevels[i] == _definitionLevel ? strings[_indices[src++]] : null;
+                }
+
+                totalRowsRead += levelsRead;
+            }
+
+            return totalRowsRead;
+        }
+
+        public int ReadIndices(Span<int> destination)
+        {
+            var totalRowsRead = 0;
+            while (totalRowsRead < destination.Length && _physicalReader.HasNext)
+            {
+                var rowsToRead = Math.Min(destination.Length - totalRowsRead, _indices.Length);
+                var levelsRead = checked((int) _physicalReader.ReadBatchWithDictionary(
+                    rowsToRead, _defLevels, Span<short>.Empty, _indices, out _, out var dictionary));
+                GetDictionaryStrings(dictionary);
+
+                var rows = destination.Slice(totalRowsRead, levelsRead);
+                for (int i = 0, src = 0; i < rows.Length; ++i)
+                {
+                    rows[i] = _defLevels == null || _defLevels[i] == _definitionLevel ? _indices[src++] : -1;
+                }
+
+                totalRowsRead += levelsRead;
+            }
+
+            return totalRowsRead;
+        }
+
+        public bool HasNext()
+        {
+            return _physicalReader.HasNext;
+        }
+
+        public long Skip(long numRowsToSkip)
+        {
+            return _physicalReader.Skip(numRowsToSkip);
+        }
+
+        /// <summary>
+        /// The dictionary is owned by the native decoder and stays the same for the whole column chunk,
+        /// so we only need to decode it again if we're given a different dictionary.
+        /// </summary>
+        private unsafe string[] GetDictionaryStrings(ReadOnlySpan<ByteArray> dictionary)
+        {
+            fixed (ByteArray* pDictionary = dictionary)
+            {
+                if (_strings != null && (IntPtr) pDictionary == _dictionary && dictionary.Length == _strings.Length)
+                {
+                    return _strings;
+                }
+
+                var strings = new string[dictionary.Length];
+                for (var i = 0; i != strings.Length; ++i)
+                {
+                    strings[i] = LogicalRead.ToString(dictionary[i]);
+                }
+
+                _dictionary = (IntPtr) pDictionary;
+                return _strings = strings;
+            }
+        }
+
+        private sealed class DictionaryIndexReader : ILogicalBatchReader<int>
+        {
+            public DictionaryIndexReader(DictionaryStringReader reader)
+            {
+                _reader = reader;
+            }
+
+            public int ReadBatch(Span<int> destination)
+            {
+                return _reader.ReadIndices(destination);
+            }
+
+            public bool HasNext()
+            {
+                return _reader.HasNext();
+            }
+
+            public long Skip(long numRowsToSkip)
+            {
+                return _reader.Skip(numRowsToSkip);
+            }
+
+            private readonly DictionaryStringReader _reader;
+        }
+
+        private readonly ColumnReader<ByteArray> _physicalReader;
+        private readonly short[]? _defLevels;
+        private readonly int[] _indices;
+        private readonly short _definitionLevel;
+        private IntPtr _dictionary;
+        private string[]? _strings;
+    }
+}
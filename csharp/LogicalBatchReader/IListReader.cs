@@ -0,0 +1,17 @@
+using System;
+
+namespace ParquetSharp.LogicalBatchReader
+{
+    /// <summary>
+    /// Reads list values in a flattened form, as offsets into a contiguous buffer of values
+    /// </summary>
+    /// <typeparam name="TItem">The type of items contained in the lists</typeparam>
+    internal interface IListReader<TItem>
+    {
+        /// <summary>
+        /// Read whole lists, up to one less than the length of offsets, while their values fit in the values buffer
+        /// </summary>
+        /// <returns>The number of lists read</returns>
+        int ReadBatch(Span<int> offsets, Span<TItem> values, Span<ulong> validity, out int valuesRead);
+    }
+}
@@ -0,0 +1,208 @@
+using System;
+
+namespace ParquetSharp.LogicalBatchReader
+{
+    /// <summary>
+    /// Reads top-level list values of fixed width leaf values in bulk using a <see cref="ListRecordReader"/>,
+    /// rather than processing repetition levels one value at a time with a buffered reader.
+    /// Lists can be read either as arrays or in a flattened form as offsets and values.
+    /// </summary>
+    /// <typeparam name="TPhysical">The underlying physical type of leaf values in the column</typeparam>
+    /// <typeparam name="TLogical">The .NET logical type for the column leaf values</typeparam>
+    internal sealed class ListReader<TPhysical, TLogical> : ILogicalBatchReader<TLogical[]?>, IListReader<TLogical>, IDisposable
+        where TPhysical : unmanaged
+    {
+        public ListReader(
+            ColumnReader<TPhysical> physicalReader,
+            LogicalRead<TLogical, TPhysical>.Converter converter,
+            int bufferLength,
+            short leafDefinitionLevel,
+            bool nullableLeafValues)
+        {
+            _physicalReader = physicalReader;
+            _converter = converter;
+            _bufferLength = bufferLength;
+            _leafDefinitionLevel = leafDefinitionLevel;
+            _nullableLeafValues = nullableLeafValues;
+            _numRows = physicalReader.RowGroupReader.MetaData.NumRows;
+        }
+
+        public void Dispose()
+        {
+            _recordReader?.Dispose();
+        }
+
+        public int ReadBatch(Span<TLogical[]?> destination)
+        {
+            var totalRowsRead = 0;
+            while (totalRowsRead < destination.Length && HasNext())
+            {
+                FillBuffer();
+
+                var rowsToRead = Math.Min(destination.Length - totalRowsRead, _numBufferedRows - _rowIndex);
+                var rows = destination.Slice(totalRowsRead, rowsToRead);
+                for (var i = 0; i != rows.Length; ++i, ++_rowIndex)
+                {
+                    var length = _offsets[_rowIndex + 1] - _offsets[_rowIndex];
+                    rows[i] = !IsValid(_rowIndex)
+                        ? null
+                        : length == 0
+                            ? Array.Empty<TLogical>()
+                            : _logicalValues.AsSpan(_offsets[_rowIndex], length).ToArray();
+                }
+
+                totalRowsRead += rowsToRead;
+            }
+
+            return totalRowsRead;
+        }
+
+        public int ReadBatch(Span<int> offsets, Span<TLogical> values, Span<ulong> validity, out int valuesRead)
+        {
+            var maxRows = offsets.Length - 1;
+            var totalRowsRead = 0;
+            valuesRead = 0;
+            if (maxRows < 0)
+            {
+                return 0;
+            }
+
+            offsets[0] = 0;
+            while (totalRowsRead < maxRows && HasNext())
+            {
+                FillBuffer();
+
+                // Only read whole rows that fit in the values buffer
+                var rowsToRead = 0;
+                var bufferStart = _offsets[_rowIndex];
+                while (rowsToRead < maxRows - totalRowsRead &&
+                       _rowIndex + rowsToRead < _numBufferedRows &&
+                       _offsets[_rowIndex + rowsToRead + 1] - bufferStart <= values.Length - valuesRead)
+                {
+                    ++rowsToRead;
+                }
+
+                if (rowsToRead == 0)
+                {
+                    if (totalRowsRead == 0)
+                    {
+                        throw new ArgumentException(
+                            $"the values buffer length ({values.Length}) is too small for the next row, which has {_offsets[_rowIndex + 1] - bufferStart} values", nameof(values));
+                    }
+                    break;
+                }
+
+                var numValues = _offsets[_rowIndex + rowsToRead] - bufferStart;
+                _logicalValues.AsSpan(bufferStart, numValues).CopyTo(values.Slice(valuesRead));
+
+                for (var i = 0; i != rowsToRead; ++i, ++_rowIndex)
+                {
+                    var row = totalRowsRead + i;
+                    offsets[row + 1] = valuesRead + _offsets[_rowIndex + 1] - bufferStart;
+                    if (IsValid(_rowIndex))
+                    {
+                        validity[row / 64] |= 1UL << (row % 64);
+                    }
+                    else
+                    {
+                        validity[row / 64] &= ~(1UL << (row % 64));
+                    }
+                }
+
+                totalRowsRead += rowsToRead;
+                valuesRead += numValues;
+            }
+
+            return totalRowsRead;
+        }
+
+        public bool HasNext()
+        {
+            return _rowIndex < _numBufferedRows || _position < _numRows;
+        }
+
+        public long Skip(long numRowsToSkip)
+        {
+            var bufferedRowsSkipped = Math.Min(numRowsToSkip, _numBufferedRows - _rowIndex);
+            _rowIndex += (int) bufferedRowsSkipped;
+
+            var skipped = RecordReader.SkipRecords(numRowsToSkip - bufferedRowsSkipped);
+            _position += skipped;
+            return bufferedRowsSkipped + skipped;
+        }
+
+        private bool IsValid(int bufferedRow) => (_listValidBits[bufferedRow / 64] & (1UL << (bufferedRow % 64))) != 0;
+
+        /// <summary>
+        /// Read the next records into the offset, validity and logical value buffers if all buffered rows have been consumed
+        /// </summary>
+        private unsafe void FillBuffer()
+        {
+            if (_rowIndex < _numBufferedRows)
+            {
+                return;
+            }
+
+            var rowsRead = checked((int) RecordReader.ReadRecords(_bufferLength, out var numValues, out var numElements));
+            if (rowsRead == 0)
+            {
+                throw new Exception($"Expected to read up to row {_numRows} but column data ended at {_position}");
+            }
+
+            EnsureCapacity(ref _offsets, rowsRead + 1);
+            EnsureCapacity(ref _listValidBits, (rowsRead + 63) / 64);
+            EnsureCapacity(ref _values, checked((int) numValues));
+            EnsureCapacity(ref _logicalValues, checked((int) numElements));
+            if (_nullableLeafValues)
+            {
+                EnsureCapacity(ref _elementDefLevels, checked((int) numElements));
+            }
+
+            fixed (TPhysical* pValues = _values)
+            fixed (short* pElementDefLevels = _elementDefLevels)
+            fixed (int* pOffsets = _offsets)
+            fixed (ulong* pListValidBits = _listValidBits)
+            {
+                RecordReader.ReadLists(rowsRead, pValues, _nullableLeafValues ? pElementDefLevels : null, pOffsets, pListValidBits);
+            }
+
+            _converter(
+                _values.AsSpan(0, (int) numValues),
+                _nullableLeafValues ? _elementDefLevels.AsSpan(0, (int) numElements) : Array.Empty<short>(),
+                _logicalValues.AsSpan(0, (int) numElements),
+                _leafDefinitionLevel);
+
+            _position += rowsRead;
+            _numBufferedRows = rowsRead;
+            _rowIndex = 0;
+        }
+
+        private static void EnsureCapacity<T>(ref T[] buffer, int length)
+        {
+            if (buffer.Length < length)
+            {
+                buffer = new T[Math.Max(length, buffer.Length * 2)];
+            }
+        }
+
+        // The column chunk is only read by the record reader once values are requested
+        private ListRecordReader RecordReader => _recordReader ??= new ListRecordReader(_physicalReader.RowGroupReader, _physicalReader.ColumnIndex);
+
+        private readonly ColumnReader<TPhysical> _physicalReader;
+        private readonly LogicalRead<TLogical, TPhysical>.Converter _converter;
+        private readonly int _bufferLength;
+        private readonly short _leafDefinitionLevel;
+        private readonly bool _nullableLeafValues;
+        private readonly long _numRows;
+        private ListRecordReader? _recordReader;
+        private long _position; // Number of records read from the record reader
+        private int _numBufferedRows;
+        private int _rowIndex; // Index of the next buffered row to return
+
+        private int[] _offsets = Array.Empty<int>();
+        private ulong[] _listValidBits = Array.Empty<ulong>();
+        private TPhysical[] _values = Array.Empty<TPhysical>();
+        private short[] _elementDefLevels = Array.Empty<short>();
+        private TLogical[] _logicalValues = Array.Empty<TLogical>();
+    }
+}
@@ -49,6 +49,12 @@ namespace ParquetSharp.LogicalBatchReader
                 }
 
                 var definitionLevel = (short) (optional ? 1 : 0);
+                if (CanReadDictionaryStrings())
+                {
+                    return (new DictionaryStringReader((_physicalReader as ColumnReader<ByteArray>)!, (LogicalStreamBuffers<ByteArray>) (object) _buffers, definitionLevel)
+                        as ILogicalBatchReader<TElement>)!;
+                }
+
                 return (
                     new ScalarReader<TLogical, TPhysical>(_physicalReader, _converter, _buffers, definitionLevel)
                         as ScalarReader<TElement, TPhysical>)!;
@@ -59,11 +65,51 @@ namespace ParquetSharp.LogicalBatchReader
             // Reference typed leaf values are always treated as nullable as the converters are created based on the
             // .NET type and don't consider the schema nullability.
             var nullableLeafValues = schemaNodes.Last().Repetition == Repetition.Optional || !typeof(TLogical).IsValueType;
+
+            if (CanReadListRecords<TElement>(schemaNodes))
+            {
+                return (ILogicalBatchReader<TElement>) (object) new ListReader<TPhysical, TLogical>(
+                    _physicalReader, _converter, _buffers.Length, leafDefinitionLevel, nullableLeafValues);
+            }
+
             _bufferedReader = new BufferedReader<TLogical, TPhysical>(
                 _physicalReader, _converter, _buffers.Values, _buffers.DefLevels, _buffers.RepLevels, leafDefinitionLevel, nullableLeafValues);
             return GetCompoundReader<TElement>(schemaNodes, 0, 0);
         }
 
+        /// <summary>
+        /// Whether string values can be read via dictionary indices rather than converting every value.
+        /// This is only possible when all data pages are dictionary encoded,
+        /// and when the user hasn't customised how string values are converted.
+        /// </summary>
+        private bool CanReadDictionaryStrings()
+        {
+            return typeof(TLogical) == typeof(string) &&
+                   typeof(TPhysical) == typeof(ByteArray) &&
+                   _physicalReader.LogicalReadConverterFactory.GetType() == typeof(LogicalReadConverterFactory) &&
+                   _physicalReader.ColumnChunkMetaData.IsFullyDictionaryEncoded;
+        }
+
+        /// <summary>
+        /// Whether values can be read in bulk with a <see cref="ListReader{TPhysical, TLogical}"/>.
+        /// This is only possible for top-level lists of fixed width values when reading all rows,
+        /// and where the logical type can represent null values if the list elements are optional.
+        /// The record reader reads the column chunk with its own page reader, so it is also only used
+        /// when the column reader hasn't created its native reader, which would have already fetched the chunk
+        /// and may have read some values.
+        /// </summary>
+        private bool CanReadListRecords<TElement>(Node[] schemaNodes)
+        {
+            return typeof(TElement) == typeof(TLogical[]) &&
+                   typeof(TPhysical) != typeof(ByteArray) &&
+                   typeof(TPhysical) != typeof(FixedLenByteArray) &&
+                   schemaNodes.Length == 3 &&
+                   SchemaUtils.IsListOrMap(schemaNodes) &&
+                   (schemaNodes[2].Repetition != Repetition.Optional || !typeof(TLogical).IsValueType || Nullable.GetUnderlyingType(typeof(TLogical)) != null) &&
+                   _physicalReader.RowRangeSelection == null &&
+                   !_physicalReader.IsHandleCreated;
+        }
+
         /// <summary>
         /// Get an internal element reader
         /// </summary>
@@ -0,0 +1,86 @@
+using System;
+
+namespace ParquetSharp.LogicalBatchReader
+{
+    /// <summary>
+    /// Restricts the rows returned by another batch reader to a set of row ranges.
+    /// The inner reader only reads the data pages selected by the <see cref="RowRangeSelection"/>,
+    /// so rows are trimmed within those pages by skipping.
+    /// </summary>
+    internal sealed class RowRangeReader<TElement> : ILogicalBatchReader<TElement>
+    {
+        public RowRangeReader(ILogicalBatchReader<TElement> innerReader, RowRangeSelection selection)
+        {
+            _innerReader = innerReader;
+            _selection = selection;
+            _next = selection.RangeOrdinals.Length > 0 ? selection.RangeOrdinals[0] : 0;
+        }
+
+        public int ReadBatch(Span<TElement> destination)
+        {
+            var totalRowsRead = 0;
+
+            while (totalRowsRead < destination.Length && HasNext())
+            {
+                if (_position < _next)
+                {
+                    _position += _innerReader.Skip(_next - _position);
+                    if (_position < _next)
+                    {
+                        throw new Exception($"Expected to skip to row ordinal {_next} but column data ended at {_position}");
+                    }
+                }
+
+                var rangeEnd = CurrentRangeEnd;
+                var rowsToRead = (int) Math.Min(destination.Length - totalRowsRead, rangeEnd - _next);
+                var rowsRead = _innerReader.ReadBatch(destination.Slice(totalRowsRead, rowsToRead));
+                if (rowsRead == 0)
+                {
+                    throw new Exception($"Expected to read up to row ordinal {rangeEnd} but column data ended at {_position}");
+                }
+
+                totalRowsRead += rowsRead;
+                _position += rowsRead;
+                Advance(rowsRead);
+            }
+
+            return totalRowsRead;
+        }
+
+        public bool HasNext()
+        {
+            return _rangeIndex < _selection.Ranges.Length;
+        }
+
+        public long Skip(long numRowsToSkip)
+        {
+            var skipped = 0L;
+
+            while (skipped < numRowsToSkip && HasNext())
+            {
+                var rowsToSkip = Math.Min(numRowsToSkip - skipped, CurrentRangeEnd - _next);
+                skipped += rowsToSkip;
+                Advance(rowsToSkip);
+            }
+
+            return skipped;
+        }
+
+        private long CurrentRangeEnd => _selection.RangeOrdinals[_rangeIndex] + _selection.Ranges[_rangeIndex].Length;
+
+        private void Advance(long numRows)
+        {
+            _next += numRows;
+            if (_next == CurrentRangeEnd && ++_rangeIndex < _selection.Ranges.Length)
+            {
+                _next = _selection.RangeOrdinals[_rangeIndex];
+            }
+        }
+
+        private readonly ILogicalBatchReader<TElement> _innerReader;
+        private readonly RowRangeSelection _selection;
+        private int _rangeIndex;
+        private long _next; // Ordinal of the next row to return
+        private long _position; // Ordinal of the next row of the inner reader
+    }
+}
@@ -122,10 +122,15 @@ namespace ParquetSharp
 
     public sealed class LogicalColumnReader<TElement> : LogicalColumnReader, IEnumerable<TElement>
     {
-        private LogicalColumnReader(ColumnReader columnReader, int bufferLength, ILogicalBatchReader<TElement> batchReader)
+        private LogicalColumnReader(
+            ColumnReader columnReader, int bufferLength, ILogicalBatchReader<TElement> batchReader,
+            DictionaryStringReader? dictionaryReader, ILogicalBatchReader<int>? indexReader, bool canReadLists)
             : base(columnReader, bufferLength)
         {
             _batchReader = batchReader;
+            _dictionaryReader = dictionaryReader;
+            _indexReader = indexReader;
+            _canReadLists = canReadLists;
         }
 
         internal static LogicalColumnReader<TElement> Create<TPhysical, TLogical>(ColumnReader columnReader, int bufferLength) where TPhysical : unmanaged
@@ -135,11 +140,22 @@ namespace ParquetSharp
             var converter = (LogicalRead<TLogical, TPhysical>.Converter) converterFactory.GetConverter<TLogical, TPhysical>(columnReader.ColumnDescriptor, columnReader.ColumnChunkMetaData);
             var schemaNodes = GetSchemaNodesPath(columnReader.ColumnDescriptor.SchemaNode);
             ILogicalBatchReader<TElement> batchReader;
+            DictionaryStringReader? dictionaryReader;
+            ILogicalBatchReader<int>? indexReader;
+            bool canReadLists;
             try
             {
                 var directReader = (LogicalRead<TLogical, TPhysical>.DirectReader?) converterFactory.GetDirectReader<TLogical, TPhysical>();
                 var readerFactory = new LogicalBatchReaderFactory<TPhysical, TLogical>((ColumnReader<TPhysical>) columnReader, directReader, converter, bufferLength);
                 batchReader = readerFactory.GetReader<TElement>(schemaNodes);
+                dictionaryReader = batchReader as DictionaryStringReader;
+                indexReader = dictionaryReader?.IndexReader;
+                canReadLists = batchReader is IListReader<TLogical>;
+                if (columnReader.RowRangeSelection != null)
+                {
+                    batchReader = new RowRangeReader<TElement>(batchReader, columnReader.RowRangeSelection);
+                    indexReader = indexReader == null ? null : new RowRangeReader<int>(indexReader, columnReader.RowRangeSelection);
+                }
             }
             finally
             {
@@ -148,7 +164,7 @@ namespace ParquetSharp
                     node.Dispose();
                 }
             }
-            return new LogicalColumnReader<TElement>(columnReader, bufferLength, batchReader);
+            return new LogicalColumnReader<TElement>(columnReader, bufferLength, batchReader, dictionaryReader, indexReader, canReadLists);
         }
 
         public override TReturn Apply<TReturn>(ILogicalColumnReaderVisitor<TReturn> visitor)
@@ -156,6 +172,12 @@ namespace ParquetSharp
             return visitor.OnLogicalColumnReader(this);
         }
 
+        public override void Dispose()
+        {
+            (_batchReader as IDisposable)?.Dispose();
+            base.Dispose();
+        }
+
         public IEnumerator<TElement> GetEnumerator()
         {
             var buffer = ArrayPool<TElement>.Shared.Rent(BufferLength);
@@ -212,6 +234,176 @@ namespace ParquetSharp
             return _batchReader.Skip(numRowsToSkip);
         }
 
+        /// <summary>
+        /// Whether values can be read as dictionary indices with <see cref="ReadDictionaryIndices"/>.
+        /// This is only the case for non-nested string columns where all data pages in the column chunk are dictionary encoded
+        /// (see <see cref="ParquetSharp.ColumnChunkMetaData.IsFullyDictionaryEncoded"/>) and no custom <see cref="LogicalReadConverterFactory"/> is used.
+        /// </summary>
+        public bool CanReadDictionaryIndices => _indexReader != null;
+
+        /// <summary>
+        /// Read a batch of values as indices into the column chunk dictionary returned by <see cref="GetDictionary"/>,
+        /// without converting each value to a string. Null values are read as -1.
+        /// Calls to this method should not be mixed with calls to <see cref="ReadBatch(Span{TElement})"/> on the same reader.
+        /// </summary>
+        /// <param name="destination">The buffer to read indices into</param>
+        /// <returns>The number of rows read</returns>
+        /// <exception cref="InvalidOperationException">Thrown if <see cref="CanReadDictionaryIndices"/> is false</exception>
+        public int ReadDictionaryIndices(Span<int> destination)
+        {
+            if (_indexReader == null) throw new InvalidOperationException("column values cannot be read as dictionary indices");
+            return _indexReader.ReadBatch(destination);
+        }
+
+        /// <summary>
+        /// Get the decoded dictionary of the column chunk that indices read with <see cref="ReadDictionaryIndices"/> refer to.
+        /// Each dictionary value is decoded only once, and the dictionary is empty if the column chunk has no values.
+        /// </summary>
+        /// <exception cref="InvalidOperationException">Thrown if <see cref="CanReadDictionaryIndices"/> is false</exception>
+        public string[] GetDictionary()
+        {
+            if (_dictionaryReader == null) throw new InvalidOperationException("column values cannot be read as dictionary indices");
+            return (string[]) _dictionaryReader.GetDictionary().Clone();
+        }
+
+        /// <summary>
+        /// Read all remaining values of the column chunk as categorical data, ie. dictionary indices and the dictionary they refer to.
+        /// </summary>
+        /// <param name="rows">The number of rows to read</param>
+        /// <param name="dictionary">The column chunk dictionary</param>
+        /// <returns>The dictionary index of each row, or -1 for null values</returns>
+        /// <exception cref="InvalidOperationException">Thrown if <see cref="CanReadDictionaryIndices"/> is false</exception>
+        public int[] ReadAllDictionaryIndices(int rows, out string[] dictionary)
+        {
+            var indices = new int[rows];
+            var read = ReadDictionaryIndices(indices);
+
+            if (read != rows)
+            {
+                throw new ArgumentException($"read {read} rows, expected {rows} rows");
+            }
+
+            dictionary = GetDictionary();
+            return indices;
+        }
+
+        /// <summary>
+        /// Read a batch of values as non-nullable values and a validity bitmap, rather than as nullable values.
+        /// This avoids reading and processing definition levels in .NET for optional columns,
+        /// and is only supported for non-repeated columns of primitive values that don't require conversion
+        /// (bool, int, uint, long, ulong, Int96, float and double), where <typeparamref name="TValue"/> is the non-nullable element type.
+        /// Calls to this method should not be mixed with calls to <see cref="ReadBatch(Span{TElement})"/> on the same reader.
+        /// </summary>
+        /// <remarks>
+        /// The validity bitmap uses the same layout as Arrow, where row i corresponds to bit (i % 64) of validity[i / 64].
+        /// Null values are set to the default value.
+        /// </remarks>
+        /// <param name="values">The buffer to read values into</param>
+        /// <param name="validity">The buffer for the validity bitmap, which must have at least one bit per value</param>
+        /// <returns>The number of rows read</returns>
+        public unsafe int ReadBatchSpaced<TValue>(Span<TValue> values, Span<ulong> validity)
+            where TValue : unmanaged
+        {
+            if ((Nullable.GetUnderlyingType(typeof(TElement)) ?? typeof(TElement)) != typeof(TValue))
+            {
+                throw new ArgumentException($"value type '{typeof(TValue)}' does not match the column element type '{typeof(TElement)}'");
+            }
+            if (!CanReadSpaced<TValue>())
+            {
+                throw new InvalidOperationException($"column values cannot be read as spaced values of type '{typeof(TValue)}'");
+            }
+            if (validity.Length < (values.Length + 63) / 64)
+            {
+                throw new ArgumentOutOfRangeException(nameof(validity), "validity has fewer bits than the length of values");
+            }
+
+            fixed (TValue* pValues = values)
+            fixed (ulong* pValidity = validity)
+            {
+                return checked((int) Source.ReadBatchSpaced(values.Length, pValues, pValidity, out _));
+            }
+        }
+
+        /// <summary>
+        /// Read all remaining values as non-nullable values and a validity bitmap, see <see cref="ReadBatchSpaced{TValue}"/>.
+        /// </summary>
+        /// <param name="rows">The number of rows to read</param>
+        /// <param name="validity">The validity bitmap</param>
+        /// <returns>The values, with null values set to the default value</returns>
+        public TValue[] ReadAllSpaced<TValue>(int rows, out ulong[] validity)
+            where TValue : unmanaged
+        {
+            var values = new TValue[rows];
+            validity = new ulong[(rows + 63) / 64];
+            var read = ReadBatchSpaced<TValue>(values, validity);
+
+            if (read != rows)
+            {
+                throw new ArgumentException($"read {read} rows, expected {rows} rows");
+            }
+
+            return values;
+        }
+
+        /// <summary>
+        /// Whether this reader supports reading list values in a flattened form with <see cref="ReadBatchLists{TItem}"/>.
+        /// This is supported for top-level lists of fixed width leaf values, when no row range selection is used.
+        /// </summary>
+        public bool CanReadLists => _canReadLists;
+
+        /// <summary>
+        /// Read a batch of list values as offsets into a contiguous buffer of list items, rather than as an array per row.
+        /// Only whole lists are read, so fewer rows may be read than fit in <paramref name="offsets"/> if the items
+        /// don't fit in <paramref name="values"/>.
+        /// Calls to this method may be mixed with calls to <see cref="ReadBatch(Span{TElement})"/> on the same reader.
+        /// </summary>
+        /// <remarks>
+        /// This uses the same layout as an Arrow list array: the items of row i are values[offsets[i]..offsets[i + 1]],
+        /// and row i is a null list if bit (i % 64) of validity[i / 64] is not set.
+        /// </remarks>
+        /// <param name="offsets">The buffer for list offsets, which must have one more entry than the maximum number of rows to read</param>
+        /// <param name="values">The buffer to read list items into</param>
+        /// <param name="validity">The buffer for the list validity bitmap, which must have at least one bit per row</param>
+        /// <param name="valuesRead">The number of list items read</param>
+        /// <returns>The number of rows read</returns>
+        /// <exception cref="InvalidOperationException">Thrown if <see cref="CanReadLists"/> is false</exception>
+        /// <exception cref="ArgumentException">Thrown if the items of the next row don't fit in <paramref name="values"/></exception>
+        public int ReadBatchLists<TItem>(Span<int> offsets, Span<TItem> values, Span<ulong> validity, out int valuesRead)
+        {
+            if (typeof(TElement) != typeof(TItem[]))
+            {
+                throw new ArgumentException($"item type '{typeof(TItem)}' does not match the column element type '{typeof(TElement)}'");
+            }
+            if (_batchReader is not IListReader<TItem> listReader)
+            {
+                throw new InvalidOperationException("column values cannot be read as flattened lists");
+            }
+            if (validity.Length < (offsets.Length + 62) / 64)
+            {
+                throw new ArgumentOutOfRangeException(nameof(validity), "validity has fewer bits than the number of rows that fit in offsets");
+            }
+
+            return listReader.ReadBatch(offsets, values, validity, out valuesRead);
+        }
+
+        private bool CanReadSpaced<TValue>()
+        {
+            var physicalType = Source.ElementType;
+            var isDirectType = typeof(TValue) == physicalType ||
+                               typeof(TValue) == typeof(uint) && physicalType == typeof(int) ||
+                               typeof(TValue) == typeof(ulong) && physicalType == typeof(long);
+
+            return isDirectType &&
+                   physicalType != typeof(ByteArray) &&
+                   physicalType != typeof(FixedLenByteArray) &&
+                   ColumnDescriptor.MaxRepetitionLevel == 0 &&
+                   Source.RowRangeSelection == null &&
+                   Source.LogicalReadConverterFactory.GetType() == typeof(LogicalReadConverterFactory);
+        }
+
         private readonly ILogicalBatchReader<TElement> _batchReader;
+        private readonly DictionaryStringReader? _dictionaryReader;
+        private readonly ILogicalBatchReader<int>? _indexReader;
+        private readonly bool _canReadLists;
     }
 }
@@ -0,0 +1,191 @@
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Reusable buffers for reading batches of physical values from multiple columns of a row group
+    /// in a single native call with <see cref="RowGroupReader.ReadBatches{TValue}(MultiColumnBatch{TValue})"/>.
+    /// </summary>
+    /// <remarks>
+    /// The value and level buffers of each column are allocated and pinned once when the batch is created,
+    /// so reading a batch doesn't allocate. Definition levels are only read for optional columns
+    /// and repetition levels for repeated columns.
+    /// Only fixed width physical types are supported, and column readers that read a row selection are not supported.
+    /// </remarks>
+    public sealed class MultiColumnBatch<TValue> : IDisposable
+        where TValue : unmanaged
+    {
+        /// <summary>
+        /// Create buffers for reading batches from a set of columns of the same row group.
+        /// </summary>
+        /// <param name="columnReaders">Readers for columns of one row group</param>
+        /// <param name="batchSize">The maximum number of levels to read from each column</param>
+        public MultiColumnBatch(IReadOnlyList<ColumnReader<TValue>> columnReaders, int batchSize)
+        {
+            if (columnReaders == null) throw new ArgumentNullException(nameof(columnReaders));
+            if (columnReaders.Count == 0) throw new ArgumentException("at least one column reader is required", nameof(columnReaders));
+            if (batchSize <= 0) throw new ArgumentOutOfRangeException(nameof(batchSize), "batchSize must be positive");
+
+            RowGroupReader.GetFixedWidthPhysicalType<TValue>();
+
+            var numColumns = columnReaders.Count;
+            _rowGroupReader = columnReaders[0].RowGroupReader;
+            _columnReaders = new ColumnReader<TValue>[numColumns];
+            for (var i = 0; i != numColumns; ++i)
+            {
+                var columnReader = columnReaders[i];
+                if (columnReader.RowGroupReader != _rowGroupReader) throw new ArgumentException($"column reader {i} does not belong to the same row group as column reader 0", nameof(columnReaders));
+                if (columnReader.RowRangeSelection != null) throw new ArgumentException($"column reader {i} reads a row selection, which is not supported by multi-column batch reads", nameof(columnReaders));
+                _columnReaders[i] = columnReader;
+            }
+
+            BatchSize = batchSize;
+            _values = new TValue[numColumns][];
+            _defLevels = new short[]?[numColumns];
+            _repLevels = new short[]?[numColumns];
+            _columnReaderHandles = new IntPtr[numColumns];
+            _buffers = new IntPtr[3 * numColumns];
+            _valuesRead = new long[numColumns];
+            _levelsRead = new long[numColumns];
+
+            try
+            {
+                // Buffers are laid out as the values, definition levels and then repetition levels of each column
+                for (var i = 0; i != numColumns; ++i)
+                {
+                    var descriptor = _columnReaders[i].ColumnDescriptor;
+                    _values[i] = new TValue[batchSize];
+                    _defLevels[i] = descriptor.MaxDefinitionLevel > 0 ? new short[batchSize] : null;
+                    _repLevels[i] = descriptor.MaxRepetitionLevel > 0 ? new short[batchSize] : null;
+                    _buffers[i] = Pin(_values[i]);
+                    _buffers[numColumns + i] = Pin(_defLevels[i]);
+                    _buffers[2 * numColumns + i] = Pin(_repLevels[i]);
+                }
+            }
+            catch
+            {
+                Free();
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Unpin the batch buffers.
+        /// </summary>
+        public void Dispose()
+        {
+            Free();
+
+            GC.SuppressFinalize(this);
+        }
+
+        ~MultiColumnBatch()
+        {
+            Free();
+        }
+
+        /// <summary>
+        /// The number of columns read.
+        /// </summary>
+        public int NumColumns => _columnReaders.Length;
+
+        /// <summary>
+        /// The maximum number of levels read from each column.
+        /// </summary>
+        public int BatchSize { get; }
+
+        /// <summary>
+        /// The non-null values read from a column by the last read.
+        /// </summary>
+        /// <param name="column">The index of the column in this batch</param>
+        public ReadOnlySpan<TValue> Values(int column) => new(_values[column], 0, (int) _valuesRead[column]);
+
+        /// <summary>
+        /// The definition levels read from a column by the last read, which are empty for required columns.
+        /// </summary>
+        /// <param name="column">The index of the column in this batch</param>
+        public ReadOnlySpan<short> DefLevels(int column) => _defLevels[column] is {} defLevels ? new(defLevels, 0, (int) _levelsRead[column]) : default;
+
+        /// <summary>
+        /// The repetition levels read from a column by the last read, which are empty for non-repeated columns.
+        /// </summary>
+        /// <param name="column">The index of the column in this batch</param>
+        public ReadOnlySpan<short> RepLevels(int column) => _repLevels[column] is {} repLevels ? new(repLevels, 0, (int) _levelsRead[column]) : default;
+
+        /// <summary>
+        /// The number of non-null values read from a column by the last read.
+        /// </summary>
+        /// <param name="column">The index of the column in this batch</param>
+        public long ValuesRead(int column) => _valuesRead[column];
+
+        /// <summary>
+        /// The number of levels read from a column by the last read.
+        /// </summary>
+        /// <param name="column">The index of the column in this batch</param>
+        public long LevelsRead(int column) => _levelsRead[column];
+
+        internal RowGroupReader RowGroupReader => _rowGroupReader;
+
+        internal unsafe void Read()
+        {
+            if (_disposed) throw new ObjectDisposedException(nameof(MultiColumnBatch<TValue>));
+
+            for (var i = 0; i != _columnReaders.Length; ++i)
+            {
+                _columnReaderHandles[i] = _columnReaders[i].Handle.IntPtr;
+            }
+
+            var numColumns = _columnReaders.Length;
+            fixed (IntPtr* pHandles = _columnReaderHandles)
+            fixed (IntPtr* pBuffers = _buffers)
+            fixed (long* pValuesRead = _valuesRead)
+            fixed (long* pLevelsRead = _levelsRead)
+            {
+                ExceptionInfo.Check(RowGroupReader.RowGroupReader_ReadBatches(
+                    pHandles, numColumns, BatchSize, pBuffers + numColumns, pBuffers + 2 * numColumns, pBuffers, pValuesRead, pLevelsRead));
+            }
+
+            foreach (var columnReader in _columnReaders)
+            {
+                GC.KeepAlive(columnReader.Handle);
+            }
+        }
+
+        private IntPtr Pin<T>(T[]? buffer)
+        {
+            if (buffer == null)
+            {
+                return IntPtr.Zero;
+            }
+
+            var handle = GCHandle.Alloc(buffer, GCHandleType.Pinned);
+            _pinned.Add(handle);
+            return handle.AddrOfPinnedObject();
+        }
+
+        private void Free()
+        {
+            foreach (var handle in _pinned)
+            {
+                handle.Free();
+            }
+
+            _pinned.Clear();
+            _disposed = true;
+        }
+
+        private readonly RowGroupReader _rowGroupReader;
+        private readonly ColumnReader<TValue>[] _columnReaders;
+        private readonly TValue[][] _values;
+        private readonly short[]?[] _defLevels;
+        private readonly short[]?[] _repLevels;
+        private readonly IntPtr[] _columnReaderHandles;
+        private readonly IntPtr[] _buffers;
+        private readonly long[] _valuesRead;
+        private readonly long[] _levelsRead;
+        private readonly List<GCHandle> _pinned = new();
+        private bool _disposed;
+    }
+}
@@ -0,0 +1,57 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// The offset index of a column chunk, which records the location and first row index of each data page.
+    /// </summary>
+    /// <remarks>
+    /// Together with the <see cref="ColumnIndex"/>, this allows finding the data pages that contain a given range of rows
+    /// without reading the column chunk.
+    /// </remarks>
+    public sealed class OffsetIndex : IDisposable
+    {
+        internal OffsetIndex(IntPtr handle)
+        {
+            Handle = new ParquetHandle(handle, OffsetIndex_Free);
+        }
+
+        public void Dispose()
+        {
+            Handle.Dispose();
+        }
+
+        /// <summary>
+        /// Get the locations of the data pages in the column chunk, in page order.
+        /// </summary>
+        public unsafe PageLocation[] PageLocations
+        {
+            get
+            {
+                var count = ExceptionInfo.Return<ulong>(Handle, OffsetIndex_Page_Locations_Count);
+                var src = (PageLocation*) ExceptionInfo.Return<IntPtr>(Handle, OffsetIndex_Page_Locations);
+                var locations = new PageLocation[count];
+
+                fixed (PageLocation* dst = locations)
+                {
+                    Buffer.MemoryCopy(src, dst, count * (ulong) sizeof(PageLocation), count * (ulong) sizeof(PageLocation));
+                }
+
+                GC.KeepAlive(Handle);
+                return locations;
+            }
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void OffsetIndex_Free(IntPtr offsetIndex);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr OffsetIndex_Page_Locations(IntPtr offsetIndex, out IntPtr pageLocations);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr OffsetIndex_Page_Locations_Count(IntPtr offsetIndex, out ulong count);
+
+        internal readonly ParquetHandle Handle;
+    }
+}
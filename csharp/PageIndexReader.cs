@@ -0,0 +1,46 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Reads the page index (<see cref="ColumnIndex"/> and <see cref="OffsetIndex"/>) of a Parquet file.
+    /// </summary>
+    /// <remarks>
+    /// The page index is only written when enabled with <see cref="WriterPropertiesBuilder.EnableWritePageIndex()"/>.
+    /// For more details, see https://github.com/apache/parquet-format/blob/master/PageIndex.md
+    /// </remarks>
+    public sealed class PageIndexReader : IDisposable
+    {
+        internal PageIndexReader(IntPtr handle, ParquetFileReader parquetFileReader)
+        {
+            _handle = new ParquetHandle(handle, PageIndexReader_Free);
+            _parquetFileReader = parquetFileReader;
+        }
+
+        public void Dispose()
+        {
+            _handle.Dispose();
+        }
+
+        /// <summary>
+        /// Get the page index reader for the specified row group.
+        /// </summary>
+        /// <param name="i">The row group index</param>
+        /// <returns>A <see cref="RowGroupPageIndexReader"/>, or null if the row group has no page index</returns>
+        public RowGroupPageIndexReader? RowGroup(int i)
+        {
+            var handle = ExceptionInfo.Return<int, IntPtr>(_handle, i, PageIndexReader_RowGroup);
+            return handle == IntPtr.Zero ? null : new RowGroupPageIndexReader(handle, _parquetFileReader);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void PageIndexReader_Free(IntPtr pageIndexReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr PageIndexReader_RowGroup(IntPtr pageIndexReader, int i, out IntPtr rowGroupPageIndexReader);
+
+        private readonly ParquetHandle _handle;
+        private readonly ParquetFileReader _parquetFileReader;
+    }
+}
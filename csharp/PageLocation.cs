@@ -0,0 +1,33 @@
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// The location of a data page within a Parquet file, as recorded in the <see cref="OffsetIndex"/>.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public readonly struct PageLocation
+    {
+        public PageLocation(long offset, int compressedPageSize, long firstRowIndex)
+        {
+            Offset = offset;
+            CompressedPageSize = compressedPageSize;
+            FirstRowIndex = firstRowIndex;
+        }
+
+        /// <summary>
+        /// Offset of the page in the file, in bytes.
+        /// </summary>
+        public readonly long Offset;
+
+        /// <summary>
+        /// Size of the page in bytes, including the page header.
+        /// </summary>
+        public readonly int CompressedPageSize;
+
+        /// <summary>
+        /// Index of the first row of the page within the row group.
+        /// </summary>
+        public readonly long FirstRowIndex;
+    }
+}
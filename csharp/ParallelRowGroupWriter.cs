@@ -0,0 +1,178 @@
+using System;
+using System.Linq;
+using System.Threading;
+using System.Threading.Tasks;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Writes a buffered row group, encoding and compressing different columns concurrently on thread pool threads.
+    /// Created with <see cref="ParquetFileWriter.AppendParallelRowGroup"/>.
+    /// </summary>
+    /// <remarks>
+    /// Batches may be submitted from any thread. Batches for the same column are written in the order they are submitted,
+    /// while batches for different columns are written in parallel.
+    /// Each column chunk is buffered in memory until the row group is closed,
+    /// at which point the column chunks are written to the file in column order.
+    /// </remarks>
+    public sealed class ParallelRowGroupWriter : IDisposable
+    {
+        internal ParallelRowGroupWriter(RowGroupWriter rowGroupWriter, int numColumns, int maxDegreeOfParallelism, int bufferLength)
+        {
+            _rowGroupWriter = rowGroupWriter;
+            _columns = new ColumnState?[numColumns];
+            _scheduler = new ConcurrentExclusiveSchedulerPair(
+                TaskScheduler.Default, maxDegreeOfParallelism == 0 ? Environment.ProcessorCount : maxDegreeOfParallelism).ConcurrentScheduler;
+            _bufferLength = bufferLength;
+        }
+
+        /// <summary>
+        /// Wait for any batches still being written, without closing the row group.
+        /// No more batches can be submitted afterwards.
+        /// Errors from writing batches are ignored, use <see cref="Close"/> to observe them.
+        /// </summary>
+        public void Dispose()
+        {
+            lock (_lock)
+            {
+                _closed = true;
+            }
+
+            try
+            {
+                WaitForWrites();
+            }
+            catch (AggregateException)
+            {
+            }
+        }
+
+        /// <summary>
+        /// Submit a batch of values to be written to a column.
+        /// </summary>
+        /// <remarks>
+        /// The values must not be modified until the returned task has completed.
+        /// If writing a batch fails, all later batches for the same column also fail.
+        /// </remarks>
+        /// <param name="column">The index of the column to write to</param>
+        /// <param name="values">The values to write</param>
+        /// <typeparam name="TElement">The logical element type of the column, which must be the same for all batches of a column</typeparam>
+        /// <returns>A task that completes once the batch has been written</returns>
+        public Task WriteColumn<TElement>(int column, TElement[] values)
+        {
+            if (values == null) throw new ArgumentNullException(nameof(values));
+
+            return WriteColumn(column, new ReadOnlyMemory<TElement>(values));
+        }
+
+        /// <summary>
+        /// Submit a batch of values to be written to a column.
+        /// </summary>
+        /// <remarks>
+        /// The values must not be modified until the returned task has completed.
+        /// If writing a batch fails, all later batches for the same column also fail.
+        /// </remarks>
+        /// <param name="column">The index of the column to write to</param>
+        /// <param name="values">The values to write</param>
+        /// <typeparam name="TElement">The logical element type of the column, which must be the same for all batches of a column</typeparam>
+        /// <returns>A task that completes once the batch has been written</returns>
+        public Task WriteColumn<TElement>(int column, ReadOnlyMemory<TElement> values)
+        {
+            lock (_lock)
+            {
+                if (_closed) throw new InvalidOperationException("the row group has already been closed");
+                if (column < 0 || column >= _columns.Length) throw new ArgumentOutOfRangeException(nameof(column), $"column index must be less than the number of columns ({_columns.Length})");
+
+                var state = _columns[column] ??= new ColumnState(_rowGroupWriter.Column(column));
+                var write = state.Tail.ContinueWith(previous =>
+                {
+                    // Don't write any more values to a column after a failed write
+                    previous.GetAwaiter().GetResult();
+                    state.GetLogicalWriter<TElement>(_bufferLength).WriteBatch(values.Span);
+                }, CancellationToken.None, TaskContinuationOptions.DenyChildAttach, _scheduler);
+
+                state.Tail = write;
+                return write;
+            }
+        }
+
+        /// <summary>
+        /// Wait for all submitted batches to be written, then close the row group, writing the buffered column chunks to the file.
+        /// </summary>
+        /// <exception cref="AggregateException">Thrown with any exceptions from writing batches, in which case the row group is not closed</exception>
+        public void Close()
+        {
+            lock (_lock)
+            {
+                _closed = true;
+            }
+
+            WaitForWrites();
+            _rowGroupWriter.Close();
+        }
+
+        private void WaitForWrites()
+        {
+            Task[] writes;
+            lock (_lock)
+            {
+                writes = _columns.Where(c => c != null).Select(c => c!.Tail).ToArray();
+            }
+
+            try
+            {
+                Task.WaitAll(writes);
+            }
+            finally
+            {
+                lock (_lock)
+                {
+                    foreach (var column in _columns)
+                    {
+                        column?.Dispose();
+                    }
+                }
+            }
+        }
+
+        private sealed class ColumnState : IDisposable
+        {
+            public ColumnState(ColumnWriter columnWriter)
+            {
+                _columnWriter = columnWriter;
+            }
+
+            public Task Tail { get; set; } = Task.CompletedTask;
+
+            public LogicalColumnWriter<TElement> GetLogicalWriter<TElement>(int bufferLength)
+            {
+                _logicalWriter ??= _columnWriter.LogicalWriter<TElement>(bufferLength);
+
+                if (_logicalWriter is not LogicalColumnWriter<TElement> logicalWriter)
+                {
+                    throw new InvalidOperationException(
+                        $"column {_columnWriter.ColumnIndex} is being written with element type '{_logicalWriter.GetType().GetGenericArguments()[0]}', not '{typeof(TElement)}'");
+                }
+
+                return logicalWriter;
+            }
+
+            public void Dispose()
+            {
+                _logicalWriter?.Dispose();
+                _logicalWriter = null;
+                _columnWriter.Dispose();
+            }
+
+            private readonly ColumnWriter _columnWriter;
+            private LogicalColumnWriter? _logicalWriter;
+        }
+
+        private readonly RowGroupWriter _rowGroupWriter;
+        private readonly ColumnState?[] _columns;
+        private readonly TaskScheduler _scheduler;
+        private readonly int _bufferLength;
+        private readonly object _lock = new();
+        private bool _closed;
+    }
+}
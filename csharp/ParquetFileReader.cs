@@ -1,7 +1,11 @@
 using System;
+using System.Collections.Generic;
 using System.IO;
+using System.Linq;
 using System.Runtime.InteropServices;
+using System.Threading.Tasks;
 using ParquetSharp.IO;
+using ParquetSharp.Predicates;
 
 namespace ParquetSharp
 {
@@ -48,17 +52,61 @@ namespace ParquetSharp
         /// <param name="readerProperties">A <see cref="ReaderProperties"/> object that configures the reader</param>
         /// <exception cref="ArgumentNullException">Thrown if the path is null</exception>
         public ParquetFileReader(string path, ReaderProperties? readerProperties)
+            : this(path, readerProperties, memoryMap: false)
+        {
+        }
+
+        /// <summary>
+        /// Create a new ParquetFileReader for reading from a file at the specified path, optionally memory mapping the file
+        /// </summary>
+        /// <remarks>
+        /// When the file is memory mapped, reads are served directly from the operating system page cache
+        /// rather than being copied into buffers allocated from the memory pool.
+        /// This reduces memory usage when the same files are opened repeatedly or by multiple processes.
+        /// Buffered stream reads (<see cref="ReaderProperties.EnableBufferedStream"/>) still copy data, so should be disabled
+        /// to get the full benefit.
+        /// </remarks>
+        /// <param name="path">Path to the Parquet file</param>
+        /// <param name="readerProperties">A <see cref="ReaderProperties"/> object that configures the reader</param>
+        /// <param name="memoryMap">Whether to memory map the file rather than reading it</param>
+        /// <exception cref="ArgumentNullException">Thrown if the path is null</exception>
+        public ParquetFileReader(string path, ReaderProperties? readerProperties, bool memoryMap)
+            : this(path, readerProperties, memoryMap, fileMetaData: null)
+        {
+        }
+
+        /// <summary>
+        /// Create a new ParquetFileReader for reading from a file at the specified path,
+        /// using previously read file metadata rather than reading and parsing the file footer again.
+        /// </summary>
+        /// <remarks>
+        /// The metadata must have been read from the same, unmodified file.
+        /// Metadata can't be reused for encrypted files, as the state needed to decrypt the column data
+        /// is set up when the footer is read.
+        /// See <see cref="FileMetaDataCache"/> for caching metadata across repeated opens of the same files.
+        /// </remarks>
+        /// <param name="path">Path to the Parquet file</param>
+        /// <param name="readerProperties">A <see cref="ReaderProperties"/> object that configures the reader</param>
+        /// <param name="memoryMap">Whether to memory map the file rather than reading it</param>
+        /// <param name="fileMetaData">The metadata of the file, or null to read it from the file</param>
+        /// <exception cref="ArgumentNullException">Thrown if the path is null</exception>
+        /// <exception cref="ArgumentException">Thrown if metadata is provided for an encrypted file or with decryption properties</exception>
+        public ParquetFileReader(string path, ReaderProperties? readerProperties, bool memoryMap, FileMetaData? fileMetaData)
         {
             if (path == null) throw new ArgumentNullException(nameof(path));
+            CheckFileMetaDataCanBeReused(readerProperties, fileMetaData);
             path = LongPath.EnsureLongPathSafe(path);
 
             using var defaultProperties = readerProperties == null ? ReaderProperties.GetDefaultReaderProperties() : null;
             var properties = readerProperties ?? defaultProperties!;
 
-            ExceptionInfo.Check(ParquetFileReader_OpenFile(path, properties.Handle.IntPtr, out var reader));
+            ExceptionInfo.Check(ParquetFileReader_OpenFile(path, memoryMap, properties.Handle.IntPtr, fileMetaData?.Handle.IntPtr ?? IntPtr.Zero, out var source, out var reader));
             _handle = new ParquetHandle(reader, ParquetFileReader_Free);
+            _source = new ParquetHandle(source, RandomAccessFile.RandomAccessFile_Free);
+            _readerProperties = properties.Copy();
 
             GC.KeepAlive(readerProperties);
+            GC.KeepAlive(fileMetaData);
         }
 
         /// <summary>
@@ -68,9 +116,29 @@ namespace ParquetSharp
         /// <param name="readerProperties">The <see cref="ReaderProperties"/> to use</param>  
         /// <exception cref="ArgumentNullException">Thrown if the file or its handle are null</exception>
         public ParquetFileReader(RandomAccessFile randomAccessFile, ReaderProperties? readerProperties)
+            : this(randomAccessFile, readerProperties, fileMetaData: null)
+        {
+        }
+
+        /// <summary>
+        /// Create a new ParquetFileReader for reading from a specified <see cref="RandomAccessFile"/>,
+        /// using previously read file metadata rather than reading and parsing the file footer again.
+        /// </summary>
+        /// <remarks>
+        /// The metadata must have been read from the same, unmodified file.
+        /// Metadata can't be reused for encrypted files, as the state needed to decrypt the column data
+        /// is set up when the footer is read.
+        /// </remarks>
+        /// <param name="randomAccessFile">The file to read</param>
+        /// <param name="readerProperties">The <see cref="ReaderProperties"/> to use</param>
+        /// <param name="fileMetaData">The metadata of the file, or null to read it from the file</param>
+        /// <exception cref="ArgumentNullException">Thrown if the file or its handle are null</exception>
+        /// <exception cref="ArgumentException">Thrown if metadata is provided for an encrypted file or with decryption properties</exception>
+        public ParquetFileReader(RandomAccessFile randomAccessFile, ReaderProperties? readerProperties, FileMetaData? fileMetaData)
         {
             if (randomAccessFile == null) throw new ArgumentNullException(nameof(randomAccessFile));
             if (randomAccessFile.Handle == null) throw new ArgumentNullException(nameof(randomAccessFile.Handle));
+            CheckFileMetaDataCanBeReused(readerProperties, fileMetaData);
 
             using var defaultProperties = readerProperties == null ? ReaderProperties.GetDefaultReaderProperties() : null;
             var properties = readerProperties ?? defaultProperties!;
@@ -85,10 +153,13 @@ namespace ParquetSharp
                 GC.KeepAlive(randomAccessFile);
             }
 
-            _handle = new ParquetHandle(ExceptionInfo.Return<IntPtr, IntPtr>(randomAccessFile.Handle, properties.Handle.IntPtr, ParquetFileReader_Open), Free);
+            _handle = new ParquetHandle(ExceptionInfo.Return<IntPtr, IntPtr, IntPtr>(
+                randomAccessFile.Handle, properties.Handle.IntPtr, fileMetaData?.Handle.IntPtr ?? IntPtr.Zero, ParquetFileReader_Open), Free);
             _randomAccessFile = randomAccessFile;
+            _readerProperties = properties.Copy();
 
             GC.KeepAlive(readerProperties);
+            GC.KeepAlive(fileMetaData);
         }
 
         /// <summary>
@@ -115,8 +186,9 @@ namespace ParquetSharp
                 GC.KeepAlive(randomAccessFile);
             }
 
-            _handle = new ParquetHandle(ExceptionInfo.Return<IntPtr, IntPtr>(randomAccessFile.Handle!, properties.Handle.IntPtr, ParquetFileReader_Open), Free);
+            _handle = new ParquetHandle(ExceptionInfo.Return<IntPtr, IntPtr, IntPtr>(randomAccessFile.Handle!, properties.Handle.IntPtr, IntPtr.Zero, ParquetFileReader_Open), Free);
             _randomAccessFile = randomAccessFile;
+            _readerProperties = properties.Copy();
             _ownedFile = true;
 
             GC.KeepAlive(readerProperties);
@@ -134,6 +206,8 @@ namespace ParquetSharp
         {
             _fileMetaData?.Dispose();
             _handle.Dispose();
+            _source?.Dispose();
+            _readerProperties?.Dispose();
             if (_ownedFile)
             {
                 _randomAccessFile?.Dispose();
@@ -168,14 +242,372 @@ namespace ParquetSharp
         /// <returns>A <see cref="RowGroupReader"/> for the specified row group index</returns>
         public RowGroupReader RowGroup(int i)
         {
-            return new(ExceptionInfo.Return<int, IntPtr>(_handle, i, ParquetFileReader_RowGroup), this);
+            return new(ExceptionInfo.Return<int, IntPtr>(_handle, i, ParquetFileReader_RowGroup), this, i);
+        }
+
+        /// <summary>
+        /// Process row groups in parallel, each with its own <see cref="RowGroupReader"/>.
+        /// </summary>
+        /// <remarks>
+        /// Row groups are processed in no particular order, and this method returns once all row groups have been processed.
+        /// Each row group reader is disposed once its callback returns, so it and any column readers created from it must not be used afterwards.
+        /// Reading from multiple row groups at once reads the file concurrently, so when reading from a <see cref="ManagedRandomAccessFile"/>,
+        /// it should be created with a positional reader to avoid serializing reads.
+        /// </remarks>
+        /// <param name="processRowGroup">Called with the index and reader of each row group</param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of row groups to process at once, or zero to use one per processor</param>
+        /// <param name="rowGroups">The indices of the row groups to process, or null to process all row groups</param>
+        /// <exception cref="AggregateException">Thrown with any exceptions thrown while processing row groups</exception>
+        public void ForEachRowGroup(Action<int, RowGroupReader> processRowGroup, int maxDegreeOfParallelism = 0, IReadOnlyList<int>? rowGroups = null)
+        {
+            if (processRowGroup == null) throw new ArgumentNullException(nameof(processRowGroup));
+
+            var scanRowGroups = GetScanRowGroups(rowGroups);
+            var options = new ParallelOptions {MaxDegreeOfParallelism = GetScanParallelism(maxDegreeOfParallelism)};
+
+            Parallel.ForEach(scanRowGroups, options, rowGroup =>
+            {
+                using var rowGroupReader = RowGroup(rowGroup);
+                processRowGroup(rowGroup, rowGroupReader);
+            });
+        }
+
+        /// <summary>
+        /// Process row groups in parallel, each with its own <see cref="RowGroupReader"/>, and return the results in row group order.
+        /// </summary>
+        /// <remarks>
+        /// Row groups are processed on thread pool threads as the results are enumerated,
+        /// with at most <paramref name="maxDegreeOfParallelism"/> row groups being processed or waiting to be enumerated at once.
+        /// Each row group reader is disposed once its function returns, so it must not be referenced by the result.
+        /// Reading from multiple row groups at once reads the file concurrently, so when reading from a <see cref="ManagedRandomAccessFile"/>,
+        /// it should be created with a positional reader to avoid serializing reads.
+        /// </remarks>
+        /// <param name="processRowGroup">Called with the index and reader of each row group to compute a result</param>
+        /// <param name="maxDegreeOfParallelism">The maximum number of row groups to process at once, or zero to use one per processor</param>
+        /// <param name="rowGroups">The indices of the row groups to process, or null to process all row groups</param>
+        /// <returns>The result for each row group, in the order of <paramref name="rowGroups"/></returns>
+        public IEnumerable<TResult> ScanRowGroups<TResult>(Func<int, RowGroupReader, TResult> processRowGroup, int maxDegreeOfParallelism = 0, IReadOnlyList<int>? rowGroups = null)
+        {
+            if (processRowGroup == null) throw new ArgumentNullException(nameof(processRowGroup));
+
+            return ScanRowGroupsOrdered(processRowGroup, GetScanParallelism(maxDegreeOfParallelism), GetScanRowGroups(rowGroups));
+        }
+
+        private IEnumerable<TResult> ScanRowGroupsOrdered<TResult>(Func<int, RowGroupReader, TResult> processRowGroup, int parallelism, int[] rowGroups)
+        {
+            var pending = new Queue<Task<TResult>>();
+            var next = 0;
+
+            try
+            {
+                while (next < rowGroups.Length || pending.Count != 0)
+                {
+                    while (next < rowGroups.Length && pending.Count < parallelism)
+                    {
+                        var rowGroup = rowGroups[next++];
+                        pending.Enqueue(Task.Run(() =>
+                        {
+                            using var rowGroupReader = RowGroup(rowGroup);
+                            return processRowGroup(rowGroup, rowGroupReader);
+                        }));
+                    }
+
+                    yield return pending.Dequeue().GetAwaiter().GetResult();
+                }
+            }
+            finally
+            {
+                // If enumeration stops early, wait for row groups still being processed so that the file can be safely disposed.
+                // Their results and any errors are discarded.
+                try
+                {
+                    Task.WaitAll(pending.ToArray<Task>());
+                }
+                catch (AggregateException)
+                {
+                }
+            }
+        }
+
+        private int[] GetScanRowGroups(IReadOnlyList<int>? rowGroups)
+        {
+            // Read the metadata before starting any workers, as it is lazily initialised
+            var numRowGroups = FileMetaData.NumRowGroups;
+            if (rowGroups == null)
+            {
+                return Enumerable.Range(0, numRowGroups).ToArray();
+            }
+
+            foreach (var rowGroup in rowGroups)
+            {
+                if (rowGroup < 0 || rowGroup >= numRowGroups) throw new ArgumentOutOfRangeException(nameof(rowGroups), $"row group index {rowGroup} is out of range");
+            }
+            return rowGroups.ToArray();
+        }
+
+        private static int GetScanParallelism(int maxDegreeOfParallelism)
+        {
+            if (maxDegreeOfParallelism < 0) throw new ArgumentOutOfRangeException(nameof(maxDegreeOfParallelism), "maxDegreeOfParallelism must not be negative");
+            return maxDegreeOfParallelism == 0 ? Environment.ProcessorCount : maxDegreeOfParallelism;
+        }
+
+        /// <summary>
+        /// Get a <see cref="ParquetSharp.PageIndexReader"/> for reading the column and offset indexes of the file.
+        /// </summary>
+        /// <returns>A <see cref="ParquetSharp.PageIndexReader"/>, or null if the file has no page index</returns>
+        public PageIndexReader? GetPageIndexReader()
+        {
+            var handle = ExceptionInfo.Return<IntPtr>(_handle, ParquetFileReader_GetPageIndexReader);
+            return handle == IntPtr.Zero ? null : new PageIndexReader(handle, this);
+        }
+
+        /// <summary>
+        /// Get a <see cref="ParquetSharp.BloomFilterReader"/> for reading the bloom filters of the file.
+        /// The returned reader is owned by this file reader.
+        /// </summary>
+        /// <returns>A <see cref="ParquetSharp.BloomFilterReader"/></returns>
+        public BloomFilterReader GetBloomFilterReader()
+        {
+            var handle = ExceptionInfo.Return<IntPtr>(_handle, ParquetFileReader_GetBloomFilterReader);
+            return new BloomFilterReader(new ChildParquetHandle(handle, _handle), this);
+        }
+
+        /// <summary>
+        /// Start reading the column chunks of the specified row groups and columns in the background,
+        /// coalescing nearby byte ranges into fewer, larger reads.
+        /// </summary>
+        /// <remarks>
+        /// Row group readers created after this call read the pre-buffered column chunks from the cache
+        /// rather than issuing one read per column chunk, which greatly reduces the number of round trips
+        /// when reading a subset of columns from high latency storage.
+        /// Each call replaces any previously pre-buffered data, so all row groups and columns that will be read
+        /// should be requested at once, before calling <see cref="RowGroup"/>.
+        /// The default cache options of Arrow are used, which issue all reads immediately.
+        /// </remarks>
+        /// <param name="rowGroups">The indices of the row groups to pre-buffer</param>
+        /// <param name="columns">The indices of the columns to pre-buffer</param>
+        public void PreBuffer(int[] rowGroups, int[] columns)
+        {
+            PreBuffer(rowGroups, columns, new CacheOptions(DefaultHoleSizeLimit, DefaultRangeSizeLimit, lazy: false));
+        }
+
+        /// <summary>
+        /// Start reading the column chunks of the specified row groups and columns in the background,
+        /// coalescing nearby byte ranges into fewer, larger reads.
+        /// </summary>
+        /// <remarks>
+        /// Row group readers created after this call read the pre-buffered column chunks from the cache
+        /// rather than issuing one read per column chunk.
+        /// Each call replaces any previously pre-buffered data, so all row groups and columns that will be read
+        /// should be requested at once, before calling <see cref="RowGroup"/>.
+        /// </remarks>
+        /// <param name="rowGroups">The indices of the row groups to pre-buffer</param>
+        /// <param name="columns">The indices of the columns to pre-buffer</param>
+        /// <param name="cacheOptions">Configures how byte ranges are coalesced and when they are read</param>
+        public unsafe void PreBuffer(int[] rowGroups, int[] columns, CacheOptions cacheOptions)
+        {
+            if (rowGroups == null) throw new ArgumentNullException(nameof(rowGroups));
+            if (columns == null) throw new ArgumentNullException(nameof(columns));
+
+            fixed (int* pRowGroups = rowGroups)
+            fixed (int* pColumns = columns)
+            {
+                ExceptionInfo.Check(ParquetFileReader_PreBuffer(
+                    _handle.IntPtr, pRowGroups, rowGroups.Length, pColumns, columns.Length,
+                    cacheOptions.hole_size_limit, cacheOptions.range_size_limit, cacheOptions.lazy, cacheOptions.prefetch_limit));
+            }
+
+            GC.KeepAlive(_handle);
+        }
+
+        /// <summary>
+        /// Wait until the column chunks of the specified row groups and columns have been pre-buffered.
+        /// </summary>
+        /// <remarks>
+        /// The row groups and columns must have been requested by a previous call to <see cref="PreBuffer(int[], int[])"/>.
+        /// Any error that occurred while reading the data is thrown from this method.
+        /// </remarks>
+        /// <param name="rowGroups">The indices of the row groups to wait for</param>
+        /// <param name="columns">The indices of the columns to wait for</param>
+        public unsafe void WaitForBuffered(int[] rowGroups, int[] columns)
+        {
+            if (rowGroups == null) throw new ArgumentNullException(nameof(rowGroups));
+            if (columns == null) throw new ArgumentNullException(nameof(columns));
+
+            fixed (int* pRowGroups = rowGroups)
+            fixed (int* pColumns = columns)
+            {
+                ExceptionInfo.Check(ParquetFileReader_WhenBuffered(_handle.IntPtr, pRowGroups, rowGroups.Length, pColumns, columns.Length));
+            }
+
+            GC.KeepAlive(_handle);
+        }
+
+        /// <summary>
+        /// Read row groups in order, fetching the column chunks of following row groups in the background
+        /// while the current row group is being read.
+        /// </summary>
+        /// <remarks>
+        /// Column chunks are pre-buffered with <see cref="PreBuffer(int[], int[])"/> in batches of whole row groups.
+        /// Before each row group is returned, the following row groups are fetched while the total compressed size of
+        /// the selected columns of row groups fetched ahead of the current row group stays within <paramref name="readAheadBytes"/>.
+        /// The current row group doesn't count towards this, so a budget of at least one row group allows reading
+        /// the next row group while the current one is decoded, and a budget of zero disables read-ahead.
+        /// Column data is decompressed and decoded when it is read from the column readers.
+        /// Each row group reader is disposed when the enumeration moves to the next row group,
+        /// and this should not be used together with other calls to <see cref="PreBuffer(int[], int[])"/>.
+        /// </remarks>
+        /// <param name="columns">The indices of the columns that will be read</param>
+        /// <param name="readAheadBytes">The maximum number of compressed column chunk bytes to fetch ahead of the current row group</param>
+        /// <param name="rowGroups">The indices of the row groups to read, or null to read all row groups</param>
+        /// <returns>A reader for each row group, in the order of <paramref name="rowGroups"/></returns>
+        public IEnumerable<RowGroupReader> ReadRowGroupsWithReadAhead(int[] columns, long readAheadBytes, IReadOnlyList<int>? rowGroups = null)
+        {
+            if (columns == null) throw new ArgumentNullException(nameof(columns));
+            if (readAheadBytes < 0) throw new ArgumentOutOfRangeException(nameof(readAheadBytes), "readAheadBytes must not be negative");
+
+            return ReadRowGroupsWithReadAhead(columns.ToArray(), readAheadBytes, GetScanRowGroups(rowGroups));
+        }
+
+        private IEnumerable<RowGroupReader> ReadRowGroupsWithReadAhead(int[] columns, long readAheadBytes, int[] rowGroups)
+        {
+            var sizes = FileMetaData.GetTotalCompressedSizes(rowGroups, columns);
+            var fetched = new Queue<(RowGroupReader Reader, long Size)>();
+            var fetchedAheadBytes = 0L; // Size of the fetched row groups following the current row group
+            var next = 0;
+
+            // Start fetching the following row groups that fit in the budget.
+            // If fetchCurrent is true, the next row group is fetched to be read now, and doesn't count towards the budget.
+            void Fetch(bool fetchCurrent)
+            {
+                var batch = new List<int>();
+                if (fetchCurrent)
+                {
+                    batch.Add(next++);
+                }
+                while (next < rowGroups.Length && fetchedAheadBytes + sizes[next] <= readAheadBytes)
+                {
+                    fetchedAheadBytes += sizes[next];
+                    batch.Add(next++);
+                }
+
+                if (batch.Count != 0)
+                {
+                    PreBuffer(batch.Select(i => rowGroups[i]).ToArray(), columns);
+
+                    // Row group readers keep a reference to the cache that was current when they were created,
+                    // so they must be created before the next call to PreBuffer.
+                    foreach (var i in batch)
+                    {
+                        fetched.Enqueue((RowGroup(rowGroups[i]), sizes[i]));
+                    }
+                }
+            }
+
+            try
+            {
+                while (next < rowGroups.Length || fetched.Count != 0)
+                {
+                    var fetchedAhead = fetched.Count != 0;
+                    if (!fetchedAhead)
+                    {
+                        Fetch(fetchCurrent: true);
+                    }
+
+                    var current = fetched.Dequeue();
+                    if (fetchedAhead)
+                    {
+                        fetchedAheadBytes -= current.Size;
+                    }
+
+                    try
+                    {
+                        // Fetch the following row groups in the background while the current row group is read
+                        Fetch(fetchCurrent: false);
+                        yield return current.Reader;
+                    }
+                    finally
+                    {
+                        current.Reader.Dispose();
+                    }
+                }
+            }
+            finally
+            {
+                foreach (var (reader, _) in fetched)
+                {
+                    reader.Dispose();
+                }
+            }
+        }
+
+        /// <summary>
+        /// Find the rows that might match a predicate, without reading any column data.
+        /// </summary>
+        /// <remarks>
+        /// Row groups are first checked against the column chunk statistics.
+        /// Row groups that might match are then narrowed down to data pages using the page index if it was written,
+        /// and equality predicates are checked against bloom filters if they were written.
+        /// </remarks>
+        /// <param name="predicate">The predicate to evaluate</param>
+        /// <returns>The selected rows of each row group</returns>
+        public RowSelection SelectRows(Predicate predicate)
+        {
+            if (predicate == null) throw new ArgumentNullException(nameof(predicate));
+
+            var boundPredicate = predicate.Bind(FileMetaData.Schema);
+            var rowGroupRanges = new RowRange[FileMetaData.NumRowGroups][];
+
+            using var pageIndexReader = GetPageIndexReader();
+
+            for (var rowGroup = 0; rowGroup != rowGroupRanges.Length; ++rowGroup)
+            {
+                using var context = new RowGroupContext(this, pageIndexReader, rowGroup);
+
+                var ranges = boundPredicate.Evaluate(context, EvaluationLevel.Statistics);
+                if (ranges.Length != 0)
+                {
+                    ranges = boundPredicate.Evaluate(context, EvaluationLevel.PageIndex);
+                }
+                if (ranges.Length != 0)
+                {
+                    ranges = boundPredicate.Evaluate(context, EvaluationLevel.BloomFilter);
+                }
+
+                rowGroupRanges[rowGroup] = ranges;
+            }
+
+            return new RowSelection(rowGroupRanges);
+        }
+
+        /// <summary>
+        /// When metadata is provided, the footer isn't parsed, so no file decryptor is created to read encrypted column data.
+        /// </summary>
+        private static void CheckFileMetaDataCanBeReused(ReaderProperties? readerProperties, FileMetaData? fileMetaData)
+        {
+            if (fileMetaData == null)
+            {
+                return;
+            }
+
+            using (var decryptionProperties = readerProperties?.FileDecryptionProperties)
+            {
+                if (decryptionProperties != null)
+                {
+                    throw new ArgumentException("file metadata cannot be reused when reading with file decryption properties", nameof(fileMetaData));
+                }
+            }
+            if (fileMetaData.IsEncrypted)
+            {
+                throw new ArgumentException("file metadata cannot be reused for an encrypted file", nameof(fileMetaData));
+            }
         }
 
         [DllImport(ParquetDll.Name)]
-        private static extern IntPtr ParquetFileReader_OpenFile([MarshalAs(UnmanagedType.LPUTF8Str)] string path, IntPtr readerProperties, out IntPtr reader);
+        private static extern IntPtr ParquetFileReader_OpenFile([MarshalAs(UnmanagedType.LPUTF8Str)] string path, [MarshalAs(UnmanagedType.I1)] bool memoryMap, IntPtr readerProperties, IntPtr metadata, out IntPtr source, out IntPtr reader);
 
         [DllImport(ParquetDll.Name)]
-        private static extern IntPtr ParquetFileReader_Open(IntPtr readableFileInterface, IntPtr readerProperties, out IntPtr reader);
+        private static extern IntPtr ParquetFileReader_Open(IntPtr readableFileInterface, IntPtr readerProperties, IntPtr metadata, out IntPtr reader);
 
         [DllImport(ParquetDll.Name)]
         private static extern void ParquetFileReader_Free(IntPtr reader);
@@ -189,9 +621,39 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr ParquetFileReader_RowGroup(IntPtr reader, int i, out IntPtr rowGroupReader);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ParquetFileReader_GetPageIndexReader(IntPtr reader, out IntPtr pageIndexReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ParquetFileReader_GetBloomFilterReader(IntPtr reader, out IntPtr bloomFilterReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr ParquetFileReader_PreBuffer(
+            IntPtr reader, int* rowGroups, int numRowGroups, int* columns, int numColumns,
+            long holeSizeLimit, long rangeSizeLimit, [MarshalAs(UnmanagedType.I1)] bool lazy, long prefetchLimit);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr ParquetFileReader_WhenBuffered(IntPtr reader, int* rowGroups, int numRowGroups, int* columns, int numColumns);
+
+        // Match the defaults of arrow::io::CacheOptions
+        private const long DefaultHoleSizeLimit = 8 * 1024;
+        private const long DefaultRangeSizeLimit = 32 * 1024 * 1024;
+
+        /// <summary>
+        /// The file this reader reads from, if known, for reading byte ranges of the file directly.
+        /// </summary>
+        internal INativeHandle? Source => _source ?? _randomAccessFile?.Handle;
+
+        /// <summary>
+        /// The properties the file was opened with, if known, for reading byte ranges of the file directly.
+        /// </summary>
+        internal ReaderProperties? ReaderProperties => _readerProperties;
+
         private readonly INativeHandle _handle;
         private FileMetaData? _fileMetaData;
+        private readonly ParquetHandle? _source; // The file opened by the reader when reading from a path
         private readonly RandomAccessFile? _randomAccessFile; // Keep a handle to the input file to prevent GC
         private readonly bool _ownedFile; // Whether this reader created the RandomAccessFile
+        private readonly ReaderProperties? _readerProperties; // A copy of the properties, which the caller may dispose
     }
 }
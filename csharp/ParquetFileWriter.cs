@@ -400,6 +400,7 @@ namespace ParquetSharp
         /// <returns>A new <see cref="RowGroupWriter"/> instance.</returns>
         public RowGroupWriter AppendRowGroup()
         {
+            _bufferedRowGroup = null;
             return new(ExceptionInfo.Return<IntPtr>(_handle, ParquetFileWriter_AppendRowGroup), this);
         }
 
@@ -411,9 +412,50 @@ namespace ParquetSharp
         /// <returns>A new <see cref="RowGroupWriter"/> instance.</returns>
         public RowGroupWriter AppendBufferedRowGroup()
         {
+            _bufferedRowGroup = null;
             return new(ExceptionInfo.Return<IntPtr>(_handle, ParquetFileWriter_AppendBufferedRowGroup), this);
         }
 
+        /// <summary>
+        /// Get the buffered row group to write the next rows to, closing the current row group and appending a new one
+        /// once the estimated compressed size of the current row group reaches <paramref name="maxRowGroupBytes"/>.
+        /// This allows bounding row groups by size rather than by number of rows.
+        /// </summary>
+        /// <remarks>
+        /// This should be called before writing each batch of rows, and after the previous batch has been written to all columns.
+        /// Column writers obtained from a previous row group must not be used once a new row group has been returned.
+        /// The size of a row group is estimated with <see cref="RowGroupWriter.EstimatedCompressedBytes"/>,
+        /// so row groups exceed the target by up to the size of one batch of rows.
+        /// </remarks>
+        /// <param name="maxRowGroupBytes">The target compressed size of each row group in bytes</param>
+        /// <returns>The current <see cref="RowGroupWriter"/>, or a new one if the current row group is full</returns>
+        public RowGroupWriter GetBufferedRowGroup(long maxRowGroupBytes)
+        {
+            if (maxRowGroupBytes <= 0) throw new ArgumentOutOfRangeException(nameof(maxRowGroupBytes), "maxRowGroupBytes must be positive");
+
+            if (_bufferedRowGroup != null && _bufferedRowGroup.NumRows > 0 && _bufferedRowGroup.EstimatedCompressedBytes >= maxRowGroupBytes)
+            {
+                // Appending a new row group closes the current one
+                _bufferedRowGroup = null;
+            }
+
+            return _bufferedRowGroup ??= AppendBufferedRowGroup();
+        }
+
+        /// <summary>
+        /// Creates and returns a new <see cref="ParallelRowGroupWriter"/> for writing a buffered row group,
+        /// where different columns are encoded and compressed in parallel.
+        /// </summary>
+        /// <param name="maxDegreeOfParallelism">The maximum number of columns to write at once, or zero to use one per processor</param>
+        /// <param name="bufferLength">The buffer length used by the logical column writers</param>
+        /// <returns>A new <see cref="ParallelRowGroupWriter"/> instance.</returns>
+        public ParallelRowGroupWriter AppendParallelRowGroup(int maxDegreeOfParallelism = 0, int bufferLength = 4 * 1024)
+        {
+            if (maxDegreeOfParallelism < 0) throw new ArgumentOutOfRangeException(nameof(maxDegreeOfParallelism), "maxDegreeOfParallelism must not be negative");
+
+            return new ParallelRowGroupWriter(AppendBufferedRowGroup(), NumColumns, maxDegreeOfParallelism, bufferLength);
+        }
+
         internal int NumColumns => ExceptionInfo.Return<int>(_handle, ParquetFileWriter_Num_Columns); // 2021-04-08: calling this results in a segfault when the writer has been closed
         internal long NumRows => ExceptionInfo.Return<long>(_handle, ParquetFileWriter_Num_Rows); // 2021-04-08: calling this results in a segfault when the writer has been closed
         internal int NumRowGroups => ExceptionInfo.Return<int>(_handle, ParquetFileWriter_Num_Row_Groups); // 2021-04-08: calling this results in a segfault when the writer has been closed
@@ -598,6 +640,7 @@ namespace ParquetSharp
         private FileMetaData? _fileMetaData;
         private WriterProperties? _writerProperties;
         private bool _keyValueMetadataSet;
+        private RowGroupWriter? _bufferedRowGroup; // The current row group returned by GetBufferedRowGroup
         private readonly OutputStream? _outputStream; // Keep a handle to the output stream to prevent GC
         private readonly bool _ownedStream; // Whether this writer created the OutputStream
     }
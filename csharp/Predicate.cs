@@ -0,0 +1,92 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+using ParquetSharp.Predicates;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// A filter over the columns of a Parquet file, used with <see cref="ParquetFileReader.SelectRows"/>
+    /// to skip row groups and data pages that cannot contain matching rows.
+    /// </summary>
+    /// <remarks>
+    /// Columns are identified by their dot separated path, for example "a.b.c" for a nested column.
+    /// Values are compared according to the column's physical type and <see cref="SortOrder"/>:
+    /// integer columns accept any integer value, floating point columns accept floating point or integer values,
+    /// and byte array columns accept strings (compared as UTF-8 bytes) or byte arrays.
+    /// Comparisons never match null values, and for repeated columns a row may match if any of its values match.
+    /// </remarks>
+    public abstract class Predicate
+    {
+        private protected Predicate()
+        {
+        }
+
+        /// <summary>
+        /// Matches rows where the column value equals the given value.
+        /// </summary>
+        public static Predicate Equal<T>(string column, T value) where T : notnull
+            => new ComparisonPredicate(column, ComparisonOperator.Equal, value);
+
+        /// <summary>
+        /// Matches rows where the column value is not null and does not equal the given value.
+        /// </summary>
+        public static Predicate NotEqual<T>(string column, T value) where T : notnull
+            => new ComparisonPredicate(column, ComparisonOperator.NotEqual, value);
+
+        /// <summary>
+        /// Matches rows where the column value is less than the given value.
+        /// </summary>
+        public static Predicate LessThan<T>(string column, T value) where T : notnull
+            => new ComparisonPredicate(column, ComparisonOperator.LessThan, value);
+
+        /// <summary>
+        /// Matches rows where the column value is less than or equal to the given value.
+        /// </summary>
+        public static Predicate LessThanOrEqual<T>(string column, T value) where T : notnull
+            => new ComparisonPredicate(column, ComparisonOperator.LessThanOrEqual, value);
+
+        /// <summary>
+        /// Matches rows where the column value is greater than the given value.
+        /// </summary>
+        public static Predicate GreaterThan<T>(string column, T value) where T : notnull
+            => new ComparisonPredicate(column, ComparisonOperator.GreaterThan, value);
+
+        /// <summary>
+        /// Matches rows where the column value is greater than or equal to the given value.
+        /// </summary>
+        public static Predicate GreaterThanOrEqual<T>(string column, T value) where T : notnull
+            => new ComparisonPredicate(column, ComparisonOperator.GreaterThanOrEqual, value);
+
+        /// <summary>
+        /// Matches rows where the column value equals any of the given values.
+        /// </summary>
+        public static Predicate In<T>(string column, IEnumerable<T> values) where T : notnull
+            => new InPredicate(column, values?.Select(v => (object) v).ToArray() ?? throw new ArgumentNullException(nameof(values)));
+
+        /// <summary>
+        /// Matches rows where the column value is null.
+        /// </summary>
+        public static Predicate IsNull(string column) => new NullPredicate(column, isNull: true);
+
+        /// <summary>
+        /// Matches rows where the column value is not null.
+        /// </summary>
+        public static Predicate IsNotNull(string column) => new NullPredicate(column, isNull: false);
+
+        /// <summary>
+        /// Matches rows that match all of the given predicates.
+        /// </summary>
+        public static Predicate And(params Predicate[] predicates) => new LogicalPredicate(isAnd: true, predicates);
+
+        /// <summary>
+        /// Matches rows that match any of the given predicates.
+        /// </summary>
+        public static Predicate Or(params Predicate[] predicates) => new LogicalPredicate(isAnd: false, predicates);
+
+        /// <summary>
+        /// Resolve the columns and values of this predicate against a file schema.
+        /// </summary>
+        internal abstract BoundPredicate Bind(SchemaDescriptor schema);
+    }
+}
@@ -0,0 +1,135 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// A predicate on a single leaf column, which decides whether a column chunk or page might match from its <see cref="ValueBounds"/>.
+    /// </summary>
+    internal sealed class BoundColumnPredicate : BoundPredicate
+    {
+        /// <param name="column">The leaf column index</param>
+        /// <param name="domain">Converts physical values of the column</param>
+        /// <param name="mightMatch">Whether any value within the given bounds might match</param>
+        /// <param name="equalValues">For equality predicates, the values to test against bloom filters</param>
+        public BoundColumnPredicate(int column, ColumnValueDomain domain, Func<ValueBounds, bool> mightMatch, IComparable[]? equalValues)
+        {
+            _column = column;
+            _domain = domain;
+            _mightMatch = mightMatch;
+            _equalValues = equalValues;
+        }
+
+        public override RowRange[] Evaluate(RowGroupContext context, EvaluationLevel level)
+        {
+            if (!_mightMatch(GetColumnChunkBounds(context)))
+            {
+                return Array.Empty<RowRange>();
+            }
+            if (level == EvaluationLevel.Statistics)
+            {
+                return context.AllRows;
+            }
+
+            var ranges = GetPageRanges(context);
+            if (ranges.Length == 0 || level == EvaluationLevel.PageIndex)
+            {
+                return ranges;
+            }
+
+            if (_equalValues != null && context.GetBloomFilter(_column) is { } bloomFilter)
+            {
+                if (!_equalValues.Any(value => _domain.MightContain(bloomFilter, value)))
+                {
+                    return Array.Empty<RowRange>();
+                }
+            }
+
+            return ranges;
+        }
+
+        private ValueBounds GetColumnChunkBounds(RowGroupContext context)
+        {
+            using var columnChunk = context.MetaData.GetColumnChunkMetaData(_column);
+            using var statistics = columnChunk.Statistics;
+
+            if (statistics == null)
+            {
+                return ValueBounds.Unknown;
+            }
+
+            var hasNullCount = statistics.HasNullCount;
+            var nullCount = statistics.NullCount;
+            var hasMinMax = _domain.IsOrdered && statistics.HasMinMax;
+
+            return new ValueBounds(
+                allNull: hasNullCount && nullCount == columnChunk.NumValues,
+                mayHaveNulls: !hasNullCount || nullCount > 0,
+                hasMinMax ? _domain.FromPhysical(statistics.MinUntyped) : null,
+                hasMinMax ? _domain.FromPhysical(statistics.MaxUntyped) : null);
+        }
+
+        private RowRange[] GetPageRanges(RowGroupContext context)
+        {
+            if (_domain.PhysicalType == PhysicalType.Int96)
+            {
+                return context.AllRows;
+            }
+
+            var columnIndex = context.GetColumnIndex(_column);
+            var offsetIndex = context.GetOffsetIndex(_column);
+            if (columnIndex == null || offsetIndex == null)
+            {
+                return context.AllRows;
+            }
+
+            var pageLocations = offsetIndex.PageLocations;
+            var nullPages = columnIndex.NullPages;
+            if (pageLocations.Length != nullPages.Length)
+            {
+                return context.AllRows;
+            }
+
+            var nullCounts = columnIndex.HasNullCounts ? columnIndex.NullCounts : null;
+            var minValues = _domain.IsOrdered ? columnIndex.MinValuesUntyped : null;
+            var maxValues = _domain.IsOrdered ? columnIndex.MaxValuesUntyped : null;
+            var ranges = new List<RowRange>();
+
+            for (var page = 0; page != pageLocations.Length; ++page)
+            {
+                var allNull = nullPages[page];
+                var hasMinMax = !allNull && minValues != null && maxValues != null;
+                var bounds = new ValueBounds(
+                    allNull,
+                    mayHaveNulls: allNull || nullCounts == null || nullCounts[page] > 0,
+                    hasMinMax ? _domain.FromPhysical(minValues!.GetValue(page)!) : null,
+                    hasMinMax ? _domain.FromPhysical(maxValues!.GetValue(page)!) : null);
+
+                if (!_mightMatch(bounds))
+                {
+                    continue;
+                }
+
+                var start = pageLocations[page].FirstRowIndex;
+                var end = page + 1 < pageLocations.Length ? pageLocations[page + 1].FirstRowIndex : context.NumRows;
+                if (ranges.Count > 0 && ranges[ranges.Count - 1].End == start)
+                {
+                    var last = ranges[ranges.Count - 1];
+                    ranges[ranges.Count - 1] = new RowRange(last.Start, end - last.Start);
+                }
+                else if (end > start)
+                {
+                    ranges.Add(new RowRange(start, end - start));
+                }
+            }
+
+            return ranges.ToArray();
+        }
+
+        private readonly int _column;
+        private readonly ColumnValueDomain _domain;
+        private readonly Func<ValueBounds, bool> _mightMatch;
+        private readonly IComparable[]? _equalValues;
+    }
+}
@@ -0,0 +1,46 @@
+using System;
+
+namespace ParquetSharp.Predicates
+{
+    internal sealed class BoundLogicalPredicate : BoundPredicate
+    {
+        public BoundLogicalPredicate(bool isAnd, BoundPredicate[] predicates)
+        {
+            _isAnd = isAnd;
+            _predicates = predicates;
+        }
+
+        public override RowRange[] Evaluate(RowGroupContext context, EvaluationLevel level)
+        {
+            if (_isAnd)
+            {
+                var ranges = context.AllRows;
+                foreach (var predicate in _predicates)
+                {
+                    if (ranges.Length == 0)
+                    {
+                        break;
+                    }
+                    ranges = RowRangeSet.Intersect(ranges, predicate.Evaluate(context, level));
+                }
+                return ranges;
+            }
+            else
+            {
+                var ranges = Array.Empty<RowRange>();
+                foreach (var predicate in _predicates)
+                {
+                    ranges = RowRangeSet.Union(ranges, predicate.Evaluate(context, level));
+                    if (ranges.Length == 1 && ranges[0].Length == context.NumRows)
+                    {
+                        break;
+                    }
+                }
+                return ranges;
+            }
+        }
+
+        private readonly bool _isAnd;
+        private readonly BoundPredicate[] _predicates;
+    }
+}
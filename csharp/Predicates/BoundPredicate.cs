@@ -0,0 +1,14 @@
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// A predicate whose columns and values have been resolved against a file schema.
+    /// </summary>
+    internal abstract class BoundPredicate
+    {
+        /// <summary>
+        /// Get the ranges of rows in a row group that might match this predicate.
+        /// </summary>
+        /// <returns>Sorted, non-overlapping row ranges</returns>
+        public abstract RowRange[] Evaluate(RowGroupContext context, EvaluationLevel level);
+    }
+}
@@ -0,0 +1,27 @@
+using System;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// Base class of predicates on a single leaf column.
+    /// </summary>
+    internal abstract class ColumnPredicate : Predicate
+    {
+        protected ColumnPredicate(string column)
+        {
+            Column = column ?? throw new ArgumentNullException(nameof(column));
+        }
+
+        public string Column { get; }
+
+        protected (int Index, ColumnValueDomain Domain) ResolveColumn(SchemaDescriptor schema)
+        {
+            var index = schema.ColumnIndex(Column);
+            if (index < 0)
+            {
+                throw new ArgumentException($"column '{Column}' was not found in the file schema");
+            }
+            return (index, new ColumnValueDomain(schema.Column(index), Column));
+        }
+    }
+}
@@ -0,0 +1,179 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// Converts predicate values and physical statistics values of a column into a common representation
+    /// that is ordered according to the column's sort order.
+    /// </summary>
+    /// <remarks>
+    /// Integers are represented as decimals so that signed and unsigned 32 and 64 bit values can all be compared,
+    /// floating point values as doubles, and byte arrays as <see cref="UnsignedBytes"/>.
+    /// A null representation means nothing can be inferred from the value.
+    /// </remarks>
+    internal sealed class ColumnValueDomain
+    {
+        public ColumnValueDomain(ColumnDescriptor descriptor, string columnPath)
+        {
+            _columnPath = columnPath;
+            _physicalType = descriptor.PhysicalType;
+            _sortOrder = descriptor.SortOrder;
+            _typeLength = descriptor.TypeLength;
+        }
+
+        public PhysicalType PhysicalType => _physicalType;
+
+        /// <summary>
+        /// Whether min and max statistics of this column can be used for pruning.
+        /// Byte arrays with a signed sort order (decimals) and INT96 values are not supported.
+        /// </summary>
+        public bool IsOrdered => _sortOrder switch
+        {
+            SortOrder.Unknown => false,
+            SortOrder.Signed => _physicalType != PhysicalType.ByteArray && _physicalType != PhysicalType.FixedLenByteArray && _physicalType != PhysicalType.Int96,
+            _ => _physicalType != PhysicalType.Int96,
+        };
+
+        /// <summary>
+        /// Convert a value given in a predicate.
+        /// </summary>
+        public IComparable? FromValue(object value)
+        {
+            switch (_physicalType)
+            {
+                case PhysicalType.Boolean when value is bool b:
+                    return b;
+
+                case PhysicalType.Int32:
+                case PhysicalType.Int64:
+                    switch (value)
+                    {
+                        case sbyte v: return (decimal) v;
+                        case byte v: return (decimal) v;
+                        case short v: return (decimal) v;
+                        case ushort v: return (decimal) v;
+                        case int v: return (decimal) v;
+                        case uint v: return (decimal) v;
+                        case long v: return (decimal) v;
+                        case ulong v: return (decimal) v;
+                    }
+                    break;
+
+                case PhysicalType.Float:
+                case PhysicalType.Double:
+                    switch (value)
+                    {
+                        case float v: return double.IsNaN(v) ? null : (double) v;
+                        case double v: return double.IsNaN(v) ? null : v;
+                        case sbyte or byte or short or ushort or int or uint or long or ulong: return Convert.ToDouble(value);
+                    }
+                    break;
+
+                case PhysicalType.ByteArray:
+                case PhysicalType.FixedLenByteArray:
+                    switch (value)
+                    {
+                        case string v: return new UnsignedBytes(System.Text.Encoding.UTF8.GetBytes(v));
+                        case byte[] v: return new UnsignedBytes(v);
+                    }
+                    break;
+
+                case PhysicalType.Int96:
+                    return null;
+            }
+
+            throw new ArgumentException($"cannot compare column '{_columnPath}' of physical type {_physicalType} with a value of type {value.GetType()}");
+        }
+
+        /// <summary>
+        /// Convert a min or max value read from statistics or the column index.
+        /// Byte array values are copied, so the owning statistics can be disposed afterwards.
+        /// </summary>
+        public IComparable? FromPhysical(object value)
+        {
+            var unsigned = _sortOrder == SortOrder.Unsigned;
+
+            switch (value)
+            {
+                case bool v: return v;
+                case int v: return unsigned ? (decimal) unchecked((uint) v) : (decimal) v;
+                case long v: return unsigned ? (decimal) unchecked((ulong) v) : (decimal) v;
+                case float v: return float.IsNaN(v) ? null : (double) v;
+                case double v: return double.IsNaN(v) ? null : v;
+                case ByteArray v: return new UnsignedBytes(Copy(v.Pointer, v.Length));
+                case FixedLenByteArray v: return new UnsignedBytes(Copy(v.Pointer, _typeLength));
+                default: return null;
+            }
+        }
+
+        /// <summary>
+        /// Test whether a converted predicate value might be present according to a bloom filter.
+        /// </summary>
+        public bool MightContain(BloomFilter bloomFilter, IComparable value)
+        {
+            switch (_physicalType)
+            {
+                case PhysicalType.Int32:
+                {
+                    var v = (decimal) value;
+                    if (_sortOrder == SortOrder.Unsigned)
+                    {
+                        return v >= uint.MinValue && v <= uint.MaxValue && bloomFilter.MightContain(unchecked((int) (uint) v));
+                    }
+                    return v >= int.MinValue && v <= int.MaxValue && bloomFilter.MightContain((int) v);
+                }
+
+                case PhysicalType.Int64:
+                {
+                    var v = (decimal) value;
+                    if (_sortOrder == SortOrder.Unsigned)
+                    {
+                        return v >= ulong.MinValue && v <= ulong.MaxValue && bloomFilter.MightContain(unchecked((long) (ulong) v));
+                    }
+                    return v >= long.MinValue && v <= long.MaxValue && bloomFilter.MightContain((long) v);
+                }
+
+                case PhysicalType.Float:
+                {
+                    // Positive and negative zero compare equal but hash differently
+                    var v = (double) value;
+                    return v == 0 || (float) v != v || bloomFilter.MightContain((float) v);
+                }
+
+                case PhysicalType.Double:
+                {
+                    var v = (double) value;
+                    return v == 0 || bloomFilter.MightContain(v);
+                }
+
+                case PhysicalType.ByteArray:
+                    return bloomFilter.MightContain(((UnsignedBytes) value).Bytes);
+
+                case PhysicalType.FixedLenByteArray:
+                {
+                    var bytes = ((UnsignedBytes) value).Bytes;
+                    return bytes.Length == _typeLength && bloomFilter.MightContain(bytes);
+                }
+
+                default:
+                    return true;
+            }
+        }
+
+        private static byte[] Copy(IntPtr pointer, int length)
+        {
+            var bytes = new byte[length];
+            if (length > 0)
+            {
+                Marshal.Copy(pointer, bytes, 0, length);
+            }
+            return bytes;
+        }
+
+        private readonly string _columnPath;
+        private readonly PhysicalType _physicalType;
+        private readonly SortOrder _sortOrder;
+        private readonly int _typeLength;
+    }
+}
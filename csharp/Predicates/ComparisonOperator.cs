@@ -0,0 +1,12 @@
+namespace ParquetSharp.Predicates
+{
+    internal enum ComparisonOperator
+    {
+        Equal,
+        NotEqual,
+        LessThan,
+        LessThanOrEqual,
+        GreaterThan,
+        GreaterThanOrEqual,
+    }
+}
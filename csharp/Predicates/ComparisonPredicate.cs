@@ -0,0 +1,62 @@
+using System;
+
+namespace ParquetSharp.Predicates
+{
+    internal sealed class ComparisonPredicate : ColumnPredicate
+    {
+        public ComparisonPredicate(string column, ComparisonOperator op, object value)
+            : base(column)
+        {
+            _operator = op;
+            _value = value ?? throw new ArgumentNullException(nameof(value));
+        }
+
+        internal override BoundPredicate Bind(SchemaDescriptor schema)
+        {
+            var (index, domain) = ResolveColumn(schema);
+            var value = domain.FromValue(_value);
+            var op = _operator;
+
+            return new BoundColumnPredicate(
+                index,
+                domain,
+                bounds => !bounds.AllNull && (value == null || bounds.Min == null || bounds.Max == null || MightMatch(op, value, bounds.Min, bounds.Max)),
+                op == ComparisonOperator.Equal && value != null ? new[] {value} : null);
+        }
+
+        public override string ToString()
+        {
+            var op = _operator switch
+            {
+                ComparisonOperator.Equal => "==",
+                ComparisonOperator.NotEqual => "!=",
+                ComparisonOperator.LessThan => "<",
+                ComparisonOperator.LessThanOrEqual => "<=",
+                ComparisonOperator.GreaterThan => ">",
+                ComparisonOperator.GreaterThanOrEqual => ">=",
+                _ => throw new ArgumentOutOfRangeException()
+            };
+            return $"{Column} {op} {_value}";
+        }
+
+        /// <summary>
+        /// Whether any value between min and max (inclusive) might satisfy the comparison.
+        /// </summary>
+        internal static bool MightMatch(ComparisonOperator op, IComparable value, IComparable min, IComparable max)
+        {
+            return op switch
+            {
+                ComparisonOperator.Equal => min.CompareTo(value) <= 0 && max.CompareTo(value) >= 0,
+                ComparisonOperator.NotEqual => min.CompareTo(value) != 0 || max.CompareTo(value) != 0,
+                ComparisonOperator.LessThan => min.CompareTo(value) < 0,
+                ComparisonOperator.LessThanOrEqual => min.CompareTo(value) <= 0,
+                ComparisonOperator.GreaterThan => max.CompareTo(value) > 0,
+                ComparisonOperator.GreaterThanOrEqual => max.CompareTo(value) >= 0,
+                _ => throw new ArgumentOutOfRangeException(nameof(op), op, null)
+            };
+        }
+
+        private readonly ComparisonOperator _operator;
+        private readonly object _value;
+    }
+}
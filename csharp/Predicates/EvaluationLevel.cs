@@ -0,0 +1,24 @@
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// The metadata used to evaluate a predicate, in increasing order of cost.
+    /// Each level also applies the checks of the levels before it.
+    /// </summary>
+    internal enum EvaluationLevel
+    {
+        /// <summary>
+        /// Column chunk statistics from the file footer.
+        /// </summary>
+        Statistics,
+
+        /// <summary>
+        /// Per-page statistics from the column index.
+        /// </summary>
+        PageIndex,
+
+        /// <summary>
+        /// Column chunk bloom filters, for equality predicates.
+        /// </summary>
+        BloomFilter,
+    }
+}
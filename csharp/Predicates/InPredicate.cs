@@ -0,0 +1,41 @@
+using System;
+using System.Linq;
+
+namespace ParquetSharp.Predicates
+{
+    internal sealed class InPredicate : ColumnPredicate
+    {
+        public InPredicate(string column, object[] values)
+            : base(column)
+        {
+            _values = values;
+        }
+
+        internal override BoundPredicate Bind(SchemaDescriptor schema)
+        {
+            var (index, domain) = ResolveColumn(schema);
+            var values = _values.Select(domain.FromValue).ToArray();
+
+            // A value that can't be represented (eg. NaN) disables pruning from min and max values and bloom filters
+            if (values.Any(v => v == null))
+            {
+                return new BoundColumnPredicate(index, domain, bounds => !bounds.AllNull, null);
+            }
+
+            var nonNullValues = values.Select(v => v!).ToArray();
+            return new BoundColumnPredicate(
+                index,
+                domain,
+                bounds => !bounds.AllNull && nonNullValues.Length != 0 && (bounds.Min == null || bounds.Max == null || nonNullValues.Any(
+                    v => ComparisonPredicate.MightMatch(ComparisonOperator.Equal, v, bounds.Min, bounds.Max))),
+                nonNullValues);
+        }
+
+        public override string ToString()
+        {
+            return $"{Column} IN ({string.Join(", ", _values)})";
+        }
+
+        private readonly object[] _values;
+    }
+}
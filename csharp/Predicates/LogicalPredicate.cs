@@ -0,0 +1,30 @@
+using System;
+using System.Linq;
+
+namespace ParquetSharp.Predicates
+{
+    internal sealed class LogicalPredicate : Predicate
+    {
+        public LogicalPredicate(bool isAnd, Predicate[] predicates)
+        {
+            if (predicates == null) throw new ArgumentNullException(nameof(predicates));
+            if (predicates.Any(p => p == null)) throw new ArgumentNullException(nameof(predicates), "predicates cannot contain null");
+
+            _isAnd = isAnd;
+            _predicates = predicates.ToArray();
+        }
+
+        internal override BoundPredicate Bind(SchemaDescriptor schema)
+        {
+            return new BoundLogicalPredicate(_isAnd, _predicates.Select(p => p.Bind(schema)).ToArray());
+        }
+
+        public override string ToString()
+        {
+            return $"({string.Join(_isAnd ? " AND " : " OR ", _predicates.Select(p => p.ToString()))})";
+        }
+
+        private readonly bool _isAnd;
+        private readonly Predicate[] _predicates;
+    }
+}
@@ -0,0 +1,26 @@
+namespace ParquetSharp.Predicates
+{
+    internal sealed class NullPredicate : ColumnPredicate
+    {
+        public NullPredicate(string column, bool isNull)
+            : base(column)
+        {
+            _isNull = isNull;
+        }
+
+        internal override BoundPredicate Bind(SchemaDescriptor schema)
+        {
+            var (index, domain) = ResolveColumn(schema);
+            var isNull = _isNull;
+
+            return new BoundColumnPredicate(index, domain, bounds => isNull ? bounds.MayHaveNulls : !bounds.AllNull, null);
+        }
+
+        public override string ToString()
+        {
+            return _isNull ? $"{Column} IS NULL" : $"{Column} IS NOT NULL";
+        }
+
+        private readonly bool _isNull;
+    }
+}
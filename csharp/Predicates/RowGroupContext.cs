@@ -0,0 +1,111 @@
+using System;
+using System.Collections.Generic;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// Lazily reads and caches the metadata of a row group used to evaluate predicates,
+    /// so that each column index, offset index and bloom filter is read at most once.
+    /// </summary>
+    internal sealed class RowGroupContext : IDisposable
+    {
+        public RowGroupContext(ParquetFileReader fileReader, PageIndexReader? pageIndexReader, int rowGroup)
+        {
+            _fileReader = fileReader;
+            _pageIndexReader = pageIndexReader;
+            _rowGroup = rowGroup;
+            _rowGroupReader = fileReader.RowGroup(rowGroup);
+            MetaData = _rowGroupReader.MetaData;
+            NumRows = MetaData.NumRows;
+            AllRows = NumRows > 0 ? new[] {new RowRange(0, NumRows)} : Array.Empty<RowRange>();
+        }
+
+        public void Dispose()
+        {
+            foreach (var index in _columnIndexes.Values)
+            {
+                index?.Dispose();
+            }
+            foreach (var index in _offsetIndexes.Values)
+            {
+                index?.Dispose();
+            }
+            foreach (var filter in _bloomFilters.Values)
+            {
+                filter?.Dispose();
+            }
+            _rowGroupPageIndexReader?.Dispose();
+            _rowGroupBloomFilterReader?.Dispose();
+            _rowGroupReader.Dispose();
+        }
+
+        public RowGroupMetaData MetaData { get; }
+
+        public long NumRows { get; }
+
+        /// <summary>
+        /// A single range covering all rows of the row group.
+        /// </summary>
+        public RowRange[] AllRows { get; }
+
+        public ColumnIndex? GetColumnIndex(int column)
+        {
+            if (!_columnIndexes.TryGetValue(column, out var index))
+            {
+                index = RowGroupPageIndexReader?.GetColumnIndex(column);
+                _columnIndexes[column] = index;
+            }
+            return index;
+        }
+
+        public OffsetIndex? GetOffsetIndex(int column)
+        {
+            if (!_offsetIndexes.TryGetValue(column, out var index))
+            {
+                index = RowGroupPageIndexReader?.GetOffsetIndex(column);
+                _offsetIndexes[column] = index;
+            }
+            return index;
+        }
+
+        public BloomFilter? GetBloomFilter(int column)
+        {
+            if (!_bloomFilters.TryGetValue(column, out var filter))
+            {
+                if (!_bloomFilterReaderCreated)
+                {
+                    _rowGroupBloomFilterReader = _fileReader.GetBloomFilterReader().RowGroup(_rowGroup);
+                    _bloomFilterReaderCreated = true;
+                }
+                filter = _rowGroupBloomFilterReader?.GetColumnBloomFilter(column);
+                _bloomFilters[column] = filter;
+            }
+            return filter;
+        }
+
+        private RowGroupPageIndexReader? RowGroupPageIndexReader
+        {
+            get
+            {
+                if (!_pageIndexReaderCreated)
+                {
+                    _rowGroupPageIndexReader = _pageIndexReader?.RowGroup(_rowGroup);
+                    _pageIndexReaderCreated = true;
+                }
+                return _rowGroupPageIndexReader;
+            }
+        }
+
+        private readonly ParquetFileReader _fileReader;
+        private readonly PageIndexReader? _pageIndexReader;
+        private readonly int _rowGroup;
+        private readonly RowGroupReader _rowGroupReader;
+        private readonly Dictionary<int, ColumnIndex?> _columnIndexes = new();
+        private readonly Dictionary<int, OffsetIndex?> _offsetIndexes = new();
+        private readonly Dictionary<int, BloomFilter?> _bloomFilters = new();
+        private RowGroupPageIndexReader? _rowGroupPageIndexReader;
+        private RowGroupBloomFilterReader? _rowGroupBloomFilterReader;
+        private bool _pageIndexReaderCreated;
+        private bool _bloomFilterReaderCreated;
+    }
+}
@@ -0,0 +1,61 @@
+using System;
+using System.Collections.Generic;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// Set operations on sorted, non-overlapping arrays of row ranges.
+    /// </summary>
+    internal static class RowRangeSet
+    {
+        public static RowRange[] Intersect(RowRange[] left, RowRange[] right)
+        {
+            var result = new List<RowRange>();
+            int l = 0, r = 0;
+
+            while (l < left.Length && r < right.Length)
+            {
+                var start = Math.Max(left[l].Start, right[r].Start);
+                var end = Math.Min(left[l].End, right[r].End);
+                if (end > start)
+                {
+                    result.Add(new RowRange(start, end - start));
+                }
+
+                if (left[l].End < right[r].End)
+                {
+                    ++l;
+                }
+                else
+                {
+                    ++r;
+                }
+            }
+
+            return result.ToArray();
+        }
+
+        public static RowRange[] Union(RowRange[] left, RowRange[] right)
+        {
+            var result = new List<RowRange>();
+            int l = 0, r = 0;
+
+            while (l < left.Length || r < right.Length)
+            {
+                var next = r == right.Length || (l < left.Length && left[l].Start <= right[r].Start) ? left[l++] : right[r++];
+
+                if (result.Count > 0 && result[result.Count - 1].End >= next.Start)
+                {
+                    var last = result[result.Count - 1];
+                    result[result.Count - 1] = new RowRange(last.Start, Math.Max(last.End, next.End) - last.Start);
+                }
+                else
+                {
+                    result.Add(next);
+                }
+            }
+
+            return result.ToArray();
+        }
+    }
+}
@@ -0,0 +1,33 @@
+using System;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// A byte array compared lexicographically as unsigned bytes, matching the Parquet unsigned sort order.
+    /// </summary>
+    internal sealed class UnsignedBytes : IComparable
+    {
+        public UnsignedBytes(byte[] bytes)
+        {
+            Bytes = bytes;
+        }
+
+        public byte[] Bytes { get; }
+
+        public int CompareTo(object? obj)
+        {
+            var other = ((UnsignedBytes) obj!).Bytes;
+            var length = Math.Min(Bytes.Length, other.Length);
+
+            for (var i = 0; i != length; ++i)
+            {
+                if (Bytes[i] != other[i])
+                {
+                    return Bytes[i] < other[i] ? -1 : 1;
+                }
+            }
+
+            return Bytes.Length.CompareTo(other.Length);
+        }
+    }
+}
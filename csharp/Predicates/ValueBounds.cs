@@ -0,0 +1,36 @@
+using System;
+
+namespace ParquetSharp.Predicates
+{
+    /// <summary>
+    /// What is known about the values of a column chunk or data page.
+    /// </summary>
+    internal readonly struct ValueBounds
+    {
+        public ValueBounds(bool allNull, bool mayHaveNulls, IComparable? min, IComparable? max)
+        {
+            AllNull = allNull;
+            MayHaveNulls = mayHaveNulls;
+            Min = min;
+            Max = max;
+        }
+
+        /// <summary>
+        /// Nothing is known about the values.
+        /// </summary>
+        public static ValueBounds Unknown => new(allNull: false, mayHaveNulls: true, null, null);
+
+        public bool AllNull { get; }
+        public bool MayHaveNulls { get; }
+
+        /// <summary>
+        /// The min value, or null if unknown.
+        /// </summary>
+        public IComparable? Min { get; }
+
+        /// <summary>
+        /// The max value, or null if unknown.
+        /// </summary>
+        public IComparable? Max { get; }
+    }
+}
@@ -36,6 +36,11 @@ namespace ParquetSharp
             Handle.Dispose();
         }
 
+        internal ReaderProperties Copy()
+        {
+            return new ReaderProperties(ExceptionInfo.Return<IntPtr>(Handle, ReaderProperties_Copy));
+        }
+
         /// <summary>
         /// Whether a buffered stream is used for reading.
         ///
@@ -203,6 +208,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr ReaderProperties_With_Memory_Pool(IntPtr memoryPool, out IntPtr readerProperties);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr ReaderProperties_Copy(IntPtr readerProperties, out IntPtr copy);
+
         [DllImport(ParquetDll.Name)]
         private static extern void ReaderProperties_Free(IntPtr readerProperties);
 
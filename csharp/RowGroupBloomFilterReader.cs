@@ -0,0 +1,48 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Reads the bloom filters of the column chunks in a row group.
+    /// </summary>
+    public sealed class RowGroupBloomFilterReader : IDisposable
+    {
+        internal RowGroupBloomFilterReader(IntPtr handle, ParquetFileReader parquetFileReader)
+        {
+            _handle = new ParquetHandle(handle, RowGroupBloomFilterReader_Free);
+            _parquetFileReader = parquetFileReader;
+        }
+
+        public void Dispose()
+        {
+            _handle.Dispose();
+        }
+
+        /// <summary>
+        /// Get the bloom filter for the specified column.
+        /// This reads the filter from the file but does not read any data pages.
+        /// </summary>
+        /// <param name="i">The column index</param>
+        /// <returns>A <see cref="BloomFilter"/>, or null if the column chunk has no bloom filter</returns>
+        public BloomFilter? GetColumnBloomFilter(int i)
+        {
+            var handle = ExceptionInfo.Return<int, IntPtr>(_handle, i, RowGroupBloomFilterReader_GetColumnBloomFilter);
+            if (handle == IntPtr.Zero)
+            {
+                return null;
+            }
+            var descriptor = _parquetFileReader.FileMetaData.Schema.Column(i);
+            return new BloomFilter(handle, descriptor.PhysicalType, descriptor.TypeLength);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void RowGroupBloomFilterReader_Free(IntPtr rowGroupBloomFilterReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr RowGroupBloomFilterReader_GetColumnBloomFilter(IntPtr rowGroupBloomFilterReader, int i, out IntPtr bloomFilter);
+
+        private readonly ParquetHandle _handle;
+        private readonly ParquetFileReader _parquetFileReader;
+    }
+}
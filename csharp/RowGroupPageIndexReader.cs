@@ -0,0 +1,56 @@
+using System;
+using System.Runtime.InteropServices;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Reads the page index of the column chunks in a row group.
+    /// </summary>
+    public sealed class RowGroupPageIndexReader : IDisposable
+    {
+        internal RowGroupPageIndexReader(IntPtr handle, ParquetFileReader parquetFileReader)
+        {
+            Handle = new ParquetHandle(handle, RowGroupPageIndexReader_Free);
+            _parquetFileReader = parquetFileReader;
+        }
+
+        public void Dispose()
+        {
+            Handle.Dispose();
+        }
+
+        /// <summary>
+        /// Get the column index for the specified column.
+        /// </summary>
+        /// <param name="i">The column index</param>
+        /// <returns>A <see cref="ColumnIndex"/>, or null if the column chunk has no column index</returns>
+        public ColumnIndex? GetColumnIndex(int i)
+        {
+            var physicalType = _parquetFileReader.FileMetaData.Schema.Column(i).PhysicalType;
+            return ColumnIndex.Create(ExceptionInfo.Return<int, IntPtr>(Handle, i, RowGroupPageIndexReader_GetColumnIndex), physicalType);
+        }
+
+        /// <summary>
+        /// Get the offset index for the specified column.
+        /// </summary>
+        /// <param name="i">The column index</param>
+        /// <returns>An <see cref="OffsetIndex"/>, or null if the column chunk has no offset index</returns>
+        public OffsetIndex? GetOffsetIndex(int i)
+        {
+            var handle = ExceptionInfo.Return<int, IntPtr>(Handle, i, RowGroupPageIndexReader_GetOffsetIndex);
+            return handle == IntPtr.Zero ? null : new OffsetIndex(handle);
+        }
+
+        [DllImport(ParquetDll.Name)]
+        private static extern void RowGroupPageIndexReader_Free(IntPtr rowGroupPageIndexReader);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr RowGroupPageIndexReader_GetColumnIndex(IntPtr rowGroupPageIndexReader, int i, out IntPtr columnIndex);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr RowGroupPageIndexReader_GetOffsetIndex(IntPtr rowGroupPageIndexReader, int i, out IntPtr offsetIndex);
+
+        internal readonly ParquetHandle Handle;
+        private readonly ParquetFileReader _parquetFileReader;
+    }
+}
@@ -1,4 +1,5 @@
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 
 namespace ParquetSharp
@@ -8,10 +9,11 @@ namespace ParquetSharp
     /// </summary>
     public sealed class RowGroupReader : IDisposable
     {
-        internal RowGroupReader(IntPtr handle, ParquetFileReader parquetFileReader)
+        internal RowGroupReader(IntPtr handle, ParquetFileReader parquetFileReader, int rowGroupIndex)
         {
             _handle = new ParquetHandle(handle, RowGroupReader_Free);
             ParquetFileReader = parquetFileReader;
+            _rowGroupIndex = rowGroupIndex;
         }
 
         public void Dispose()
@@ -30,22 +32,247 @@ namespace ParquetSharp
         /// <param name="i">The column index</param>
         /// <returns>A column reader for the specified column index</returns>
         public ColumnReader Column(int i) => ColumnReader.Create(
-            ExceptionInfo.Return<int, IntPtr>(_handle, i, RowGroupReader_Column),
+            () => ExceptionInfo.Return<int, IntPtr>(_handle, i, RowGroupReader_Column),
             this,
             MetaData.GetColumnChunkMetaData(i),
             i);
 
+        /// <summary>
+        /// Get a column reader for the specified column index that only reads the specified rows.
+        /// </summary>
+        /// <remarks>
+        /// If the column chunk has an offset index (see <see cref="WriterPropertiesBuilder.EnableWritePageIndex()"/>),
+        /// data pages that don't contain any of the requested rows are skipped without being decompressed or decoded.
+        /// Otherwise all pages are read.
+        /// When reading from a path, a <see cref="IO.RandomAccessFile"/> or a stream, only the byte ranges of the dictionary page
+        /// and the selected data pages are read from the file, using the page locations from the offset index,
+        /// and these are read in full when the column reader is first used.
+        /// Pages of encrypted columns, and of files opened from an Arrow <see cref="Arrow.FileReader"/>, are read through the
+        /// column chunk's stream instead, which reads the whole column chunk unless
+        /// <see cref="ReaderProperties.EnableBufferedStream"/> is used, in which case skipped pages are stepped over without being read.
+        /// Logical readers created from the returned column reader only return the requested rows,
+        /// whereas reading physical values directly returns all rows of the pages that were read
+        /// (see <see cref="ColumnReader.PageRowRanges"/>).
+        /// </remarks>
+        /// <param name="i">The column index</param>
+        /// <param name="rowRanges">The ranges of rows to read, relative to the start of the row group</param>
+        /// <returns>A column reader for the specified column index</returns>
+        public ColumnReader Column(int i, IReadOnlyList<RowRange> rowRanges)
+        {
+            if (rowRanges == null) throw new ArgumentNullException(nameof(rowRanges));
+
+            PageLocation[]? pageLocations = null;
+            using (var pageIndexReader = ParquetFileReader.GetPageIndexReader())
+            using (var rowGroupPageIndexReader = pageIndexReader?.RowGroup(_rowGroupIndex))
+            using (var offsetIndex = rowGroupPageIndexReader?.GetOffsetIndex(i))
+            {
+                pageLocations = offsetIndex?.PageLocations;
+            }
+
+            var selection = new RowRangeSelection(rowRanges, MetaData.NumRows, pageLocations);
+            Func<IntPtr> createHandle = selection.SelectedPages == null
+                ? () => ExceptionInfo.Return<int, IntPtr>(_handle, i, RowGroupReader_Column)
+                : () => ColumnSelectedPages(i, pageLocations!, selection.SelectedPages);
+
+            return ColumnReader.Create(createHandle, this, MetaData.GetColumnChunkMetaData(i), i, selection);
+        }
+
+        /// <summary>
+        /// Get a column reader for the specified column index that only reads the rows of this row group
+        /// selected by <see cref="ParquetFileReader.SelectRows"/>.
+        /// </summary>
+        /// <param name="i">The column index</param>
+        /// <param name="selection">The rows selected in the file this row group belongs to</param>
+        /// <returns>A column reader for the specified column index</returns>
+        public ColumnReader Column(int i, RowSelection selection)
+        {
+            if (selection == null) throw new ArgumentNullException(nameof(selection));
+
+            return Column(i, selection.RowRanges(_rowGroupIndex));
+        }
+
+        /// <summary>
+        /// Read a batch of physical values from each of the columns of a <see cref="MultiColumnBatch{TValue}"/> in a single native call.
+        /// This avoids the per-column overhead of calling <see cref="ColumnReader{TValue}.ReadBatch(long, Span{short}, Span{short}, Span{TValue}, out long)"/>
+        /// on each reader when reading many columns with small batches.
+        /// Unlike <see cref="ColumnReader{TValue}.ReadBatch(long, Span{short}, Span{short}, Span{TValue}, out long)"/>,
+        /// each column is read across data pages until <see cref="MultiColumnBatch{TValue}.BatchSize"/> levels have been read
+        /// or the column chunk ends.
+        /// </summary>
+        /// <remarks>
+        /// The batch buffers are reused, so the data read by a previous call is overwritten.
+        /// </remarks>
+        /// <param name="batch">The batch to read into, created from column readers of this row group</param>
+        public void ReadBatches<TValue>(MultiColumnBatch<TValue> batch)
+            where TValue : unmanaged
+        {
+            if (batch == null) throw new ArgumentNullException(nameof(batch));
+            if (batch.RowGroupReader != this) throw new ArgumentException("the batch does not read columns of this row group", nameof(batch));
+
+            batch.Read();
+        }
+
+        /// <summary>
+        /// Read whole column chunks of physical values from multiple columns of this row group in parallel.
+        /// Each column chunk is read from the file and decoded on one of up to <paramref name="numThreads"/> threads,
+        /// including the calling thread.
+        /// </summary>
+        /// <remarks>
+        /// This reads the file concurrently, which the built-in Arrow input files support.
+        /// A <see cref="IO.ManagedRandomAccessFile"/> only supports concurrent reads when it is created with a
+        /// <see cref="IO.ManagedRandomAccessFile.PositionalReader"/>. Otherwise each read seeks and reads the stream while holding a lock,
+        /// so column chunks are read from the file one at a time, although they are still decoded in parallel.
+        /// Only fixed width physical types are supported.
+        /// Definition levels must be provided for optional columns and repetition levels for repeated columns.
+        /// The buffers for each column must be large enough to hold all levels of its column chunk.
+        /// </remarks>
+        /// <param name="columnIndices">The indices of the columns to read</param>
+        /// <param name="values">The buffer to read non-null values into for each column</param>
+        /// <param name="defLevels">The buffer to read definition levels into for each column, or null if not required</param>
+        /// <param name="repLevels">The buffer to read repetition levels into for each column, or null if not required</param>
+        /// <param name="valuesRead">Receives the number of values read from each column</param>
+        /// <param name="levelsRead">Receives the number of levels read from each column</param>
+        /// <param name="numThreads">The maximum number of threads to use, or zero to use one per processor</param>
+        public unsafe void ReadColumns<TValue>(
+            IReadOnlyList<int> columnIndices,
+            IReadOnlyList<TValue[]> values,
+            IReadOnlyList<short[]?>? defLevels,
+            IReadOnlyList<short[]?>? repLevels,
+            Span<long> valuesRead,
+            Span<long> levelsRead,
+            int numThreads = 0)
+            where TValue : unmanaged
+        {
+            if (columnIndices == null) throw new ArgumentNullException(nameof(columnIndices));
+            if (values == null) throw new ArgumentNullException(nameof(values));
+
+            var numColumns = columnIndices.Count;
+            if (values.Count != numColumns) throw new ArgumentException("the number of value buffers does not match the number of columns", nameof(values));
+            if (defLevels != null && defLevels.Count != numColumns) throw new ArgumentException("the number of definition level buffers does not match the number of columns", nameof(defLevels));
+            if (repLevels != null && repLevels.Count != numColumns) throw new ArgumentException("the number of repetition level buffers does not match the number of columns", nameof(repLevels));
+            if (valuesRead.Length < numColumns) throw new ArgumentOutOfRangeException(nameof(valuesRead), "valuesRead is shorter than the number of columns");
+            if (levelsRead.Length < numColumns) throw new ArgumentOutOfRangeException(nameof(levelsRead), "levelsRead is shorter than the number of columns");
+            if (numThreads < 0) throw new ArgumentOutOfRangeException(nameof(numThreads), "numThreads must not be negative");
+
+            var physicalType = GetFixedWidthPhysicalType<TValue>();
+            var indices = new int[numColumns];
+            var bufferLengths = new long[numColumns];
+            for (var i = 0; i != numColumns; ++i)
+            {
+                indices[i] = columnIndices[i];
+                using (var columnChunkMetaData = MetaData.GetColumnChunkMetaData(indices[i]))
+                {
+                    if (columnChunkMetaData.Type != physicalType) throw new ArgumentException($"column {indices[i]} has physical type {columnChunkMetaData.Type}, not {physicalType}", nameof(columnIndices));
+                }
+
+                // Levels can't be read beyond the end of any of the column buffers
+                bufferLengths[i] = values[i].Length;
+                if (defLevels?[i] is {} def) bufferLengths[i] = Math.Min(bufferLengths[i], def.Length);
+                if (repLevels?[i] is {} rep) bufferLengths[i] = Math.Min(bufferLengths[i], rep.Length);
+            }
+
+            var buffers = new IntPtr[3 * numColumns];
+            var pinned = new List<GCHandle>(3 * numColumns);
+
+            try
+            {
+                for (var i = 0; i != numColumns; ++i)
+                {
+                    buffers[i] = Pin(values[i], pinned);
+                    buffers[numColumns + i] = Pin(defLevels?[i], pinned);
+                    buffers[2 * numColumns + i] = Pin(repLevels?[i], pinned);
+                }
+
+                fixed (int* pIndices = indices)
+                fixed (long* pBufferLengths = bufferLengths)
+                fixed (IntPtr* pBuffers = buffers)
+                fixed (long* pValuesRead = valuesRead)
+                fixed (long* pLevelsRead = levelsRead)
+                {
+                    ExceptionInfo.Check(RowGroupReader_ReadColumns(
+                        _handle.IntPtr, pIndices, numColumns, pBufferLengths, pBuffers + numColumns, pBuffers + 2 * numColumns, pBuffers, pValuesRead, pLevelsRead, numThreads));
+                    GC.KeepAlive(_handle);
+                }
+            }
+            finally
+            {
+                foreach (var handle in pinned)
+                {
+                    handle.Free();
+                }
+            }
+        }
+
+        internal static PhysicalType GetFixedWidthPhysicalType<TValue>()
+        {
+            if (typeof(TValue) == typeof(bool)) return PhysicalType.Boolean;
+            if (typeof(TValue) == typeof(int)) return PhysicalType.Int32;
+            if (typeof(TValue) == typeof(long)) return PhysicalType.Int64;
+            if (typeof(TValue) == typeof(Int96)) return PhysicalType.Int96;
+            if (typeof(TValue) == typeof(float)) return PhysicalType.Float;
+            if (typeof(TValue) == typeof(double)) return PhysicalType.Double;
+
+            throw new NotSupportedException($"type '{typeof(TValue)}' is not a fixed width physical type");
+        }
+
+        private static IntPtr Pin<T>(T[]? buffer, List<GCHandle> pinned)
+        {
+            if (buffer == null)
+            {
+                return IntPtr.Zero;
+            }
+
+            var handle = GCHandle.Alloc(buffer, GCHandleType.Pinned);
+            pinned.Add(handle);
+            return handle.AddrOfPinnedObject();
+        }
+
+        private unsafe IntPtr ColumnSelectedPages(int i, PageLocation[] pageLocations, bool[] selectedPages)
+        {
+            var fileMetaData = ParquetFileReader.FileMetaData;
+            var source = ParquetFileReader.Source;
+            var readerProperties = ParquetFileReader.ReaderProperties;
+
+            fixed (PageLocation* pPageLocations = pageLocations)
+            fixed (bool* pSelectedPages = selectedPages)
+            {
+                ExceptionInfo.Check(RowGroupReader_Column_Selected_Pages(
+                    _handle.IntPtr, fileMetaData.Handle.IntPtr, source?.IntPtr ?? IntPtr.Zero, readerProperties?.Handle.IntPtr ?? IntPtr.Zero, i, pPageLocations, pSelectedPages, selectedPages.Length, out var columnReader));
+                GC.KeepAlive(_handle);
+                GC.KeepAlive(fileMetaData);
+                GC.KeepAlive(source);
+                GC.KeepAlive(readerProperties);
+                return columnReader;
+            }
+        }
+
         [DllImport(ParquetDll.Name)]
         private static extern void RowGroupReader_Free(IntPtr rowGroupReader);
 
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr RowGroupReader_Column(IntPtr rowGroupReader, int i, out IntPtr columnReader);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr RowGroupReader_Column_Selected_Pages(
+            IntPtr rowGroupReader, IntPtr fileMetaData, IntPtr source, IntPtr readerProperties, int i, PageLocation* pageLocations, bool* selectedPages, int numPages, out IntPtr columnReader);
+
+        [DllImport(ParquetDll.Name)]
+        internal static extern unsafe IntPtr RowGroupReader_ReadBatches(
+            IntPtr* columnReaders, int numColumns, long batchSize, IntPtr* defLevels, IntPtr* repLevels, IntPtr* values, long* valuesRead, long* levelsRead);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern unsafe IntPtr RowGroupReader_ReadColumns(
+            IntPtr rowGroupReader, int* columnIndices, int numColumns, long* bufferLengths, IntPtr* defLevels, IntPtr* repLevels, IntPtr* values,
+            long* valuesRead, long* levelsRead, int numThreads);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr RowGroupReader_Metadata(IntPtr rowGroupReader, out IntPtr rowGroupMetaData);
 
+        internal INativeHandle Handle => _handle;
+
         private readonly ParquetHandle _handle;
         internal readonly ParquetFileReader ParquetFileReader;
+        private readonly int _rowGroupIndex;
         private RowGroupMetaData? _metaData;
     }
 }
@@ -33,6 +33,15 @@ namespace ParquetSharp
         public long TotalCompressedBytes => ExceptionInfo.Return<long>(_handle, RowGroupWriter_Total_Compressed_Bytes);
         public bool Buffered => ExceptionInfo.Return<bool>(_handle, RowGroupWriter_Buffered);
 
+        /// <summary>
+        /// An estimate of the compressed size of the row group written so far.
+        /// </summary>
+        /// <remarks>
+        /// This includes the compressed size of all pages written so far, and for a buffered row group,
+        /// the encoded size of values that have not yet been written to a page, which are counted before compression.
+        /// </remarks>
+        public long EstimatedCompressedBytes => ExceptionInfo.Return<long>(_handle, RowGroupWriter_Estimated_Compressed_Bytes);
+
         /// <summary>
         /// Get the column writer for the i-th column.
         /// </summary>
@@ -82,6 +91,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr RowGroupWriter_Total_Compressed_Bytes(IntPtr rowGroupWriter, out long totalCompressedBytes);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr RowGroupWriter_Estimated_Compressed_Bytes(IntPtr rowGroupWriter, out long estimatedCompressedBytes);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr RowGroupWriter_Buffered(IntPtr rowGroupWriter, out bool buffered);
 
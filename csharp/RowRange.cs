@@ -0,0 +1,59 @@
+using System;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// A contiguous range of rows within a row group.
+    /// </summary>
+    public readonly struct RowRange : IEquatable<RowRange>
+    {
+        /// <summary>
+        /// Create a new row range.
+        /// </summary>
+        /// <param name="start">Index of the first row in the range, relative to the start of the row group</param>
+        /// <param name="length">Number of rows in the range</param>
+        public RowRange(long start, long length)
+        {
+            if (start < 0) throw new ArgumentOutOfRangeException(nameof(start), "start must be non-negative");
+            if (length < 0) throw new ArgumentOutOfRangeException(nameof(length), "length must be non-negative");
+
+            Start = start;
+            Length = length;
+        }
+
+        /// <summary>
+        /// Index of the first row in the range.
+        /// </summary>
+        public long Start { get; }
+
+        /// <summary>
+        /// Number of rows in the range.
+        /// </summary>
+        public long Length { get; }
+
+        /// <summary>
+        /// Index one past the last row in the range.
+        /// </summary>
+        public long End => Start + Length;
+
+        public bool Equals(RowRange other)
+        {
+            return Start == other.Start && Length == other.Length;
+        }
+
+        public override bool Equals(object? obj)
+        {
+            return obj is RowRange other && Equals(other);
+        }
+
+        public override int GetHashCode()
+        {
+            return HashCode.Combine(Start, Length);
+        }
+
+        public override string ToString()
+        {
+            return $"[{Start}, {End})";
+        }
+    }
+}
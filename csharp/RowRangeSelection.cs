@@ -0,0 +1,118 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// Maps a set of requested row ranges within a row group onto the data pages that need to be read.
+    /// </summary>
+    /// <remarks>
+    /// Rows are only read from the selected pages, so the underlying column reader sees a stream of rows made up of
+    /// the selected page row ranges concatenated together. Positions within that stream are referred to as ordinals.
+    /// </remarks>
+    internal sealed class RowRangeSelection
+    {
+        public RowRangeSelection(IEnumerable<RowRange> rowRanges, long numRows, PageLocation[]? pageLocations)
+        {
+            Ranges = Normalize(rowRanges, numRows);
+
+            if (pageLocations == null || pageLocations.Length == 0)
+            {
+                SelectedPages = null;
+                PageRanges = numRows > 0 ? new[] {new RowRange(0, numRows)} : Array.Empty<RowRange>();
+            }
+            else
+            {
+                SelectedPages = new bool[pageLocations.Length];
+                var pageRanges = new List<RowRange>();
+                var rangeIndex = 0;
+
+                for (var page = 0; page < pageLocations.Length; ++page)
+                {
+                    var pageStart = pageLocations[page].FirstRowIndex;
+                    var pageEnd = page + 1 < pageLocations.Length ? pageLocations[page + 1].FirstRowIndex : numRows;
+
+                    while (rangeIndex < Ranges.Length && Ranges[rangeIndex].End <= pageStart)
+                    {
+                        ++rangeIndex;
+                    }
+
+                    if (rangeIndex < Ranges.Length && Ranges[rangeIndex].Start < pageEnd)
+                    {
+                        SelectedPages[page] = true;
+                        AddMerged(pageRanges, new RowRange(pageStart, pageEnd - pageStart));
+                    }
+                }
+
+                PageRanges = pageRanges.ToArray();
+            }
+
+            RangeOrdinals = Ranges.Select(range => ToOrdinal(range.Start)).ToArray();
+        }
+
+        /// <summary>
+        /// The requested row ranges, sorted, merged and clipped to the row group.
+        /// </summary>
+        public RowRange[] Ranges { get; }
+
+        /// <summary>
+        /// The row ranges covered by the selected data pages.
+        /// </summary>
+        public RowRange[] PageRanges { get; }
+
+        /// <summary>
+        /// For each data page in the offset index, whether it needs to be read,
+        /// or null if there is no offset index and all pages are read.
+        /// </summary>
+        public bool[]? SelectedPages { get; }
+
+        /// <summary>
+        /// The position of the first row of each requested range within the stream of rows read from the selected pages.
+        /// </summary>
+        public long[] RangeOrdinals { get; }
+
+        private long ToOrdinal(long row)
+        {
+            var ordinal = 0L;
+            foreach (var pageRange in PageRanges)
+            {
+                if (row < pageRange.End)
+                {
+                    return ordinal + Math.Max(row - pageRange.Start, 0);
+                }
+                ordinal += pageRange.Length;
+            }
+            return ordinal;
+        }
+
+        private static RowRange[] Normalize(IEnumerable<RowRange> rowRanges, long numRows)
+        {
+            var ranges = new List<RowRange>();
+
+            foreach (var range in rowRanges.OrderBy(r => r.Start))
+            {
+                var end = Math.Min(range.End, numRows);
+                if (end > range.Start)
+                {
+                    AddMerged(ranges, new RowRange(range.Start, end - range.Start));
+                }
+            }
+
+            return ranges.ToArray();
+        }
+
+        private static void AddMerged(List<RowRange> ranges, RowRange range)
+        {
+            if (ranges.Count > 0 && ranges[ranges.Count - 1].End >= range.Start)
+            {
+                var last = ranges[ranges.Count - 1];
+                ranges[ranges.Count - 1] = new RowRange(last.Start, Math.Max(last.End, range.End) - last.Start);
+            }
+            else
+            {
+                ranges.Add(range);
+            }
+        }
+    }
+}
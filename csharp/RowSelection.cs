@@ -0,0 +1,60 @@
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+namespace ParquetSharp
+{
+    /// <summary>
+    /// The rows of each row group of a file that might match a <see cref="Predicate"/>,
+    /// as returned by <see cref="ParquetFileReader.SelectRows"/>.
+    /// </summary>
+    /// <remarks>
+    /// The selection is conservative: every matching row is selected, but selected rows don't necessarily match,
+    /// so the predicate still needs to be applied to the values read.
+    /// Pass the selection to <see cref="RowGroupReader.Column(int, RowSelection)"/> to only read the selected rows.
+    /// </remarks>
+    public sealed class RowSelection
+    {
+        internal RowSelection(RowRange[][] rowGroupRanges)
+        {
+            _rowGroupRanges = rowGroupRanges;
+        }
+
+        /// <summary>
+        /// The number of row groups in the file.
+        /// </summary>
+        public int NumRowGroups => _rowGroupRanges.Length;
+
+        /// <summary>
+        /// The total number of selected rows.
+        /// </summary>
+        public long NumRows => _rowGroupRanges.Sum(ranges => ranges.Sum(range => range.Length));
+
+        /// <summary>
+        /// The indices of the row groups with at least one selected row.
+        /// </summary>
+        public IEnumerable<int> SelectedRowGroups => Enumerable.Range(0, NumRowGroups).Where(IsRowGroupSelected);
+
+        /// <summary>
+        /// Whether any rows of a row group are selected. Row groups without any selected rows can be skipped entirely.
+        /// </summary>
+        /// <param name="rowGroup">The row group index</param>
+        public bool IsRowGroupSelected(int rowGroup) => RowRanges(rowGroup).Count != 0;
+
+        /// <summary>
+        /// The selected ranges of rows in a row group, sorted and non-overlapping.
+        /// </summary>
+        /// <param name="rowGroup">The row group index</param>
+        /// <returns>Row ranges relative to the start of the row group</returns>
+        public IReadOnlyList<RowRange> RowRanges(int rowGroup)
+        {
+            if (rowGroup < 0 || rowGroup >= _rowGroupRanges.Length)
+            {
+                throw new ArgumentOutOfRangeException(nameof(rowGroup), $"row group index {rowGroup} is out of range for a file with {_rowGroupRanges.Length} row groups");
+            }
+            return _rowGroupRanges[rowGroup];
+        }
+
+        private readonly RowRange[][] _rowGroupRanges;
+    }
+}
@@ -51,6 +51,7 @@ namespace ParquetSharp
 
         public long DistinctCount => ExceptionInfo.Return<long>(Handle, Statistics_Distinct_Count);
         public bool HasMinMax => ExceptionInfo.Return<bool>(Handle, Statistics_HasMinMax);
+        public bool HasNullCount => ExceptionInfo.Return<bool>(Handle, Statistics_HasNullCount);
         public long NullCount => ExceptionInfo.Return<long>(Handle, Statistics_Null_Count);
         public long NumValues => ExceptionInfo.Return<long>(Handle, Statistics_Num_Values);
         public PhysicalType PhysicalType => ExceptionInfo.Return<PhysicalType>(Handle, Statistics_Physical_Type);
@@ -67,6 +68,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr Statistics_HasMinMax(IntPtr statistics, [MarshalAs(UnmanagedType.I1)] out bool hasMinMax);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr Statistics_HasNullCount(IntPtr statistics, [MarshalAs(UnmanagedType.I1)] out bool hasNullCount);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr Statistics_Null_Count(IntPtr statistics, out long nullCount);
 
@@ -199,6 +199,19 @@ namespace ParquetSharp
             return ExceptionInfo.Return<ulong>(Handle, path.Handle, WriterProperties_Max_Statistics_Size);
         }
 
+        /// <summary>
+        /// Get the bloom filter options for the specified column.
+        /// </summary>
+        /// <param name="path">The <see cref="ColumnPath"/> of the column.</param>
+        /// <returns>The bloom filter options, or null if no bloom filter is written for this column.</returns>
+        public BloomFilterOptions? BloomFilterOptions(ColumnPath path)
+        {
+            ExceptionInfo.Check(WriterProperties_Bloom_Filter_Options(Handle.IntPtr, path.Handle.IntPtr, out var enabled, out var ndv, out var fpp));
+            GC.KeepAlive(Handle);
+            GC.KeepAlive(path);
+            return enabled ? new BloomFilterOptions(ndv, fpp) : (BloomFilterOptions?) null;
+        }
+
         /// <summary>
         /// Whether CRC checksums are written for data pages
         /// </summary>
@@ -322,6 +335,9 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr WriterProperties_Page_Index_Enabled_For_Path(IntPtr writerProperties, IntPtr path, out bool enabled);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr WriterProperties_Bloom_Filter_Options(IntPtr writerProperties, IntPtr path, [MarshalAs(UnmanagedType.I1)] out bool enabled, out int ndv, out double fpp);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr WriterProperties_Page_Checksum_Enabled(IntPtr writerProperties, out bool enabled);
 
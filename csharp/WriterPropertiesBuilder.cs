@@ -454,6 +454,78 @@ namespace ParquetSharp
             return this;
         }
 
+        /// <summary>
+        /// Enable writing a bloom filter for a specific column, using the default <see cref="ParquetSharp.BloomFilterOptions"/>.
+        /// </summary>
+        /// <param name="path">The <see cref="ColumnPath"/> of the column to write a bloom filter for.</param>
+        /// <returns>This builder instance.</returns>
+        public WriterPropertiesBuilder EnableBloomFilter(ColumnPath path)
+        {
+            return EnableBloomFilter(path, ParquetSharp.BloomFilterOptions.Default);
+        }
+
+        /// <summary>
+        /// Enable writing a bloom filter for a specific column.
+        /// </summary>
+        /// <param name="path">The <see cref="ColumnPath"/> of the column to write a bloom filter for.</param>
+        /// <param name="options">The expected number of distinct values and false positive probability used to size the filter.</param>
+        /// <returns>This builder instance.</returns>
+        public WriterPropertiesBuilder EnableBloomFilter(ColumnPath path, BloomFilterOptions options)
+        {
+            ExceptionInfo.Check(WriterPropertiesBuilder_Enable_Bloom_Filter_By_ColumnPath(_handle.IntPtr, path.Handle.IntPtr, options.Ndv, options.Fpp));
+            GC.KeepAlive(_handle);
+            GC.KeepAlive(path);
+            return this;
+        }
+
+        /// <summary>
+        /// Enable writing a bloom filter for a specific column, using the default <see cref="ParquetSharp.BloomFilterOptions"/>.
+        /// </summary>
+        /// <param name="path">The path of the column to write a bloom filter for.</param>
+        /// <returns>This builder instance.</returns>
+        public WriterPropertiesBuilder EnableBloomFilter(string path)
+        {
+            return EnableBloomFilter(path, ParquetSharp.BloomFilterOptions.Default);
+        }
+
+        /// <summary>
+        /// Enable writing a bloom filter for a specific column.
+        /// </summary>
+        /// <param name="path">The path of the column to write a bloom filter for.</param>
+        /// <param name="options">The expected number of distinct values and false positive probability used to size the filter.</param>
+        /// <returns>This builder instance.</returns>
+        public WriterPropertiesBuilder EnableBloomFilter(string path, BloomFilterOptions options)
+        {
+            ExceptionInfo.Check(WriterPropertiesBuilder_Enable_Bloom_Filter_By_Path(_handle.IntPtr, path, options.Ndv, options.Fpp));
+            GC.KeepAlive(_handle);
+            return this;
+        }
+
+        /// <summary>
+        /// Disable writing a bloom filter for a specific column.
+        /// </summary>
+        /// <param name="path">The <see cref="ColumnPath"/> of the column to disable the bloom filter for.</param>
+        /// <returns>This builder instance.</returns>
+        public WriterPropertiesBuilder DisableBloomFilter(ColumnPath path)
+        {
+            ExceptionInfo.Check(WriterPropertiesBuilder_Disable_Bloom_Filter_By_ColumnPath(_handle.IntPtr, path.Handle.IntPtr));
+            GC.KeepAlive(_handle);
+            GC.KeepAlive(path);
+            return this;
+        }
+
+        /// <summary>
+        /// Disable writing a bloom filter for a specific column.
+        /// </summary>
+        /// <param name="path">The path of the column to disable the bloom filter for.</param>
+        /// <returns>This builder instance.</returns>
+        public WriterPropertiesBuilder DisableBloomFilter(string path)
+        {
+            ExceptionInfo.Check(WriterPropertiesBuilder_Disable_Bloom_Filter_By_Path(_handle.IntPtr, path));
+            GC.KeepAlive(_handle);
+            return this;
+        }
+
         /// <summary>
         /// Enable writing CRC checksums for data pages.
         /// </summary>
@@ -824,6 +896,18 @@ namespace ParquetSharp
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr WriterPropertiesBuilder_Disable_Write_Page_Index_By_ColumnPath(IntPtr builder, IntPtr path);
 
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr WriterPropertiesBuilder_Enable_Bloom_Filter_By_Path(IntPtr builder, [MarshalAs(UnmanagedType.LPUTF8Str)] string path, int ndv, double fpp);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr WriterPropertiesBuilder_Enable_Bloom_Filter_By_ColumnPath(IntPtr builder, IntPtr path, int ndv, double fpp);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr WriterPropertiesBuilder_Disable_Bloom_Filter_By_Path(IntPtr builder, [MarshalAs(UnmanagedType.LPUTF8Str)] string path);
+
+        [DllImport(ParquetDll.Name)]
+        private static extern IntPtr WriterPropertiesBuilder_Disable_Bloom_Filter_By_ColumnPath(IntPtr builder, IntPtr path);
+
         [DllImport(ParquetDll.Name)]
         private static extern IntPtr WriterPropertiesBuilder_Enable_Page_Checksum(IntPtr builder);
 